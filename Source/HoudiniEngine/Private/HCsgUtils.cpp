@@ -34,6 +34,7 @@
 
 #include "ActorEditorUtils.h"
 #include "Misc/ScopedSlowTask.h"
+#include "Async/ParallelFor.h"
 
 
 DEFINE_LOG_CATEGORY_STATIC(LogHCsgUtils, Log, All);
@@ -1285,46 +1286,60 @@ void UHCsgUtils::bspMergeCoplanars( UModel* Model, bool RemapLinks, bool MergeDi
 	for( int32 i=0; i<Model->Polys->Element.Num(); i++ )
 		Model->Polys->Element[i].PolyFlags &= ~PF_EdProcessed;
 
-	// Find matching coplanars and merge them.
-	FMemMark Mark(FMemStack::Get());
-	int32* PolyList = new(FMemStack::Get(),Model->Polys->Element.Num())int32;
-	int32 n=0;
+	// Only polys sharing the same link can be merged, so bucket them by link first
+	TMap<int32, TArray<int32>> PolysByLink;
 	for( int32 i=0; i<Model->Polys->Element.Num(); i++ )
 	{
-		FPoly* EdPoly = &Model->Polys->Element[i];
-		if( EdPoly->Vertices.Num()>0 && !(EdPoly->PolyFlags & PF_EdProcessed) )
+		if( Model->Polys->Element[i].Vertices.Num()>0 )
+			PolysByLink.FindOrAdd(Model->Polys->Element[i].iLink).Add(i);
+	}
+
+	// Find matching coplanars.
+	// Each poly belongs to at most one coplanar set, so the sets can be merged independently.
+	TArray<TArray<int32>> CoplanarSets;
+	for( auto& LinkedPolys : PolysByLink )
+	{
+		const TArray<int32>& PolyIndices = LinkedPolys.Value;
+		for( int32 k=0; k<PolyIndices.Num(); k++ )
 		{
-			int32 PolyCount         =  0;
-			PolyList[PolyCount++] =  i;
-			EdPoly->PolyFlags    |= PF_EdProcessed;
-			for( int32 j=i+1; j<Model->Polys->Element.Num(); j++ )
+			FPoly* EdPoly = &Model->Polys->Element[PolyIndices[k]];
+			if( EdPoly->PolyFlags & PF_EdProcessed )
+				continue;
+
+			TArray<int32> PolyList;
+			PolyList.Add(PolyIndices[k]);
+			EdPoly->PolyFlags |= PF_EdProcessed;
+			for( int32 m=k+1; m<PolyIndices.Num(); m++ )
 			{
-				FPoly* OtherPoly = &Model->Polys->Element[j];
-				if( OtherPoly->iLink == EdPoly->iLink && OtherPoly->Vertices.Num() )
+				FPoly* OtherPoly = &Model->Polys->Element[PolyIndices[m]];
+				if( OtherPoly->PolyFlags & PF_EdProcessed )
+					continue;
+
+				float Dist = (OtherPoly->Vertices[0] - EdPoly->Vertices[0]) | EdPoly->Normal;
+				if
+				(	Dist>-0.001
+				&&	Dist<0.001
+				&&	(OtherPoly->Normal|EdPoly->Normal)>0.9999
+				&&	(MergeDisparateTextures
+					||	(	FVector::PointsAreNear(OtherPoly->TextureU,EdPoly->TextureU,THRESH_VECTORS_ARE_NEAR)
+						&&	FVector::PointsAreNear(OtherPoly->TextureV,EdPoly->TextureV,THRESH_VECTORS_ARE_NEAR) ) ) )
 				{
-					float Dist = (OtherPoly->Vertices[0] - EdPoly->Vertices[0]) | EdPoly->Normal;
-					if
-					(	Dist>-0.001
-					&&	Dist<0.001
-					&&	(OtherPoly->Normal|EdPoly->Normal)>0.9999
-					&&	(MergeDisparateTextures
-						||	(	FVector::PointsAreNear(OtherPoly->TextureU,EdPoly->TextureU,THRESH_VECTORS_ARE_NEAR)
-							&&	FVector::PointsAreNear(OtherPoly->TextureV,EdPoly->TextureV,THRESH_VECTORS_ARE_NEAR) ) ) )
-					{
-						OtherPoly->PolyFlags |= PF_EdProcessed;
-						PolyList[PolyCount++] = j;
-					}
+					OtherPoly->PolyFlags |= PF_EdProcessed;
+					PolyList.Add(PolyIndices[m]);
 				}
 			}
-			if( PolyCount > 1 )
-			{
-				MergeCoplanars( Model, PolyList, PolyCount );
-				n++;
-			}
+
+			if( PolyList.Num() > 1 )
+				CoplanarSets.Add(MoveTemp(PolyList));
 		}
 	}
-//	UE_LOG(LogEditorBsp, Log,  TEXT("Found %i coplanar sets in %i"), n, Model->Polys->Element.Num() );
-	Mark.Pop();
+
+	// Merge them.
+	ParallelFor(CoplanarSets.Num(), [&](int32 SetIndex)
+	{
+		MergeCoplanars( Model, CoplanarSets[SetIndex].GetData(), CoplanarSets[SetIndex].Num() );
+	});
+//	UE_LOG(LogEditorBsp, Log,  TEXT("Found %i coplanar sets in %i"), CoplanarSets.Num(), Model->Polys->Element.Num() );
 
 	// Get rid of empty EdPolys while remapping iLinks.
 	FMemMark Mark2(FMemStack::Get());
@@ -36,6 +36,9 @@
 #include "HoudiniEngineTask.h"
 #include "HoudiniEngineTaskInfo.h"
 #include "HoudiniAssetComponent.h"
+#include "HoudiniObjectPathCache.h"
+#include "HoudiniMaterialTranslator.h"
+#include "HoudiniOutputTranslator.h"
 #include "HAPI/HAPI_Version.h"
 
 #include "Modules/ModuleManager.h"
@@ -204,6 +207,9 @@ FHoudiniEngine::StartupModule()
 	// Create Houdini Asset Manager
 	HoudiniEngineManager = new FHoudiniEngineManager();
 
+	// Start tracking asset changes for the object path cache
+	FHoudiniObjectPathCache::Initialize();
+
 	// Set the default value for pausing houdini engine cooking
 	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
 	bEnableCookingGlobal = !HoudiniRuntimeSettings->bPauseCookingOnStart;
@@ -237,6 +243,12 @@ FHoudiniEngine::ShutdownModule()
 {
 	HOUDINI_LOG_MESSAGE(TEXT("Shutting down the Houdini Engine module."));
 
+	// Stop tracking asset changes and release the cached objects
+	FHoudiniObjectPathCache::Shutdown();
+
+	// Forget the generated textures
+	FHoudiniMaterialTranslator::ClearTextureCache();
+
 	// We no longer need the Houdini logo static mesh.
 	if (HoudiniLogoStaticMesh.IsValid())
 	{
@@ -623,6 +635,9 @@ FHoudiniEngine::InitializeHAPISession()
 		return false;
 	}
 
+	// Don't reuse the discovery cook counts of a previous session
+	FHoudiniOutputTranslator::ClearDiscoveryCookCounts();
+
 	// Now, initialize HAPI with the new session
 	// We need to make sure HAPI version is correct.
 	int32 RunningEngineMajor = 0;
@@ -726,6 +741,7 @@ FHoudiniEngine::OnSessionLost()
 	Session.id = -1;
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
+	FHoudiniOutputTranslator::ClearDiscoveryCookCounts();
 	HoudiniEngineManager->StopHoudiniTicking();
 
 	// This indicates that we likely have lost the session due to a crash in HARS/Houdini
@@ -760,6 +776,9 @@ FHoudiniEngine::StopSession(HAPI_Session*& SessionPtr)
 	Session.type = HAPI_SESSION_MAX;
 	bEnableSessionSync = false;
 
+	// The node ids of the previous session are no longer valid
+	FHoudiniOutputTranslator::ClearDiscoveryCookCounts();
+
 	HoudiniEngineManager->StopHoudiniTicking();
 
 	return true;
@@ -945,6 +964,13 @@ FHoudiniEngine::StopTicking()
 	StopSession(SessionPtr);	
 }
 
+void
+FHoudiniEngine::ReleaseCompilingMaterials(UHoudiniAssetComponent* HAC)
+{
+	if (HoudiniEngineManager)
+		HoudiniEngineManager->ReleaseCompilingMaterials(HAC);
+}
+
 bool
 FHoudiniEngine::IsCookingEnabled() const
 {
@@ -102,6 +102,10 @@ class HOUDINIENGINE_API FHoudiniEngine : public IModuleInterface
 		// Stops the HoudiniEngineManager ticking and invalidate the session
 		void StopTicking();
 
+		// Restores the output materials replaced by a placeholder while compiling, for the given HAC or all HACs if null.
+		// Must be called before baking or saving the outputs so the placeholder isn't persisted.
+		void ReleaseCompilingMaterials(UHoudiniAssetComponent* HAC);
+
 		// Initialize HAPI
 		bool InitializeHAPISession();
 
@@ -38,9 +38,13 @@
 #include "HoudiniOutputTranslator.h"
 #include "HoudiniHandleTranslator.h"
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniMaterialTranslator.h"
+#include "HoudiniRuntimeSettings.h"
 #include "Misc/MessageDialog.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Containers/Ticker.h"
+#include "Components/MeshComponent.h"
+#include "Materials/MaterialInterface.h"
 
 #if WITH_EDITOR
 	#include "Editor.h"
@@ -51,8 +55,14 @@
 	#include "UnrealEdGlobals.h"
 	#include "Editor/UnrealEdEngine.h"
 	#include "IPackageAutoSaver.h"
+	#include "Widgets/Notifications/SNotificationList.h"
+	#include "Framework/Notifications/NotificationManager.h"
 #endif
 
+DECLARE_STATS_GROUP(TEXT("HoudiniEngine"), STATGROUP_HoudiniEngine, STATCAT_Advanced);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Material Compile Wait Time"), STAT_HoudiniMaterialCompileWaitTime, STATGROUP_HoudiniEngine);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Compiling Output Materials"), STAT_HoudiniCompilingOutputMaterials, STATGROUP_HoudiniEngine);
+
 FHoudiniEngineManager::FHoudiniEngineManager()
 	: CurrentIndex(0)
 	, ComponentCount(0)
@@ -101,6 +111,9 @@ FHoudiniEngineManager::StopHoudiniTicking()
 			// Reset time for delayed notification.
 			FHoudiniEngine::Get().SetHapiNotificationStartedTime(0.0);
 
+			// The gated materials won't be swapped in by the tick anymore
+			ReleaseCompilingMaterials(nullptr);
+
 			bMustStopTicking = false;
 		}
 		else
@@ -280,6 +293,9 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	// Update PDG Contexts and asset link if needed
 	PDGManager.Update();
 
+	// Swap in the output materials that have finished compiling
+	UpdateCompilingMaterials();
+
 	// Session Sync Updates
 	if (FHoudiniEngine::Get().IsSessionSyncEnabled())
 	{
@@ -999,6 +1015,11 @@ FHoudiniEngineManager::PostCook(UHoudiniAssetComponent* HAC, const bool& bSucces
 		FHoudiniOutputTranslator::UpdateOutputs(HAC, ForceUpdate, bHasHoudiniStaticMeshOutput);
 		HAC->SetNoProxyMeshNextCookRequested(false);
 
+		// Display the placeholder material on the outputs while their generated materials are compiling
+		const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bUsePlaceholderMaterialWhileCompiling)
+			GateCompilingMaterials(HAC);
+
 		// Handles have to be updated after parameters
 		FHoudiniHandleTranslator::UpdateHandles(HAC);  
 
@@ -1155,6 +1176,9 @@ FHoudiniEngineManager::StartTaskAssetDelete(const HAPI_NodeId& InNodeId, FGuid&
 		}
 	}
 
+	// The asset's geo node ids will be reused
+	FHoudiniOutputTranslator::ClearDiscoveryCookCounts(InNodeId);
+
 	// Generate GUID for our new task.
 	OutTaskGUID = FGuid::NewGuid();
 
@@ -1554,3 +1578,197 @@ FHoudiniEngineManager::EnableEditorAutoSave(const UHoudiniAssetComponent* HAC =
 	AutoSaver.ResetAutoSaveTimer();
 #endif
 }
+
+void
+FHoudiniEngineManager::GateCompilingMaterials(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill())
+		return;
+
+	// Restore the slots gated by a previous cook first
+	ReleaseCompilingMaterials(HAC);
+
+	// The outputs are about to be baked, the placeholder would end up in the baked actors
+	if (HAC->IsBakeAfterNextCookEnabled() || HAC->GetOnPostCookBakeDelegate().IsBound())
+		return;
+
+	UMaterialInterface* PlaceholderMaterial = FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get();
+	if (!PlaceholderMaterial || PlaceholderMaterial->IsPendingKill())
+		return;
+
+	FHoudiniMaterialCompileGate Gate;
+	TSet<UMaterialInterface*> CompilingMaterials;
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+	{
+		if (!CurOutput || CurOutput->IsPendingKill())
+			continue;
+
+		for (auto& CurOutputObject : CurOutput->GetOutputObjects())
+		{
+			UMeshComponent* MeshComponents[2] = 
+			{
+				Cast<UMeshComponent>(CurOutputObject.Value.OutputComponent),
+				Cast<UMeshComponent>(CurOutputObject.Value.ProxyComponent)
+			};
+
+			for (UMeshComponent* MeshComponent : MeshComponents)
+			{
+				if (!MeshComponent || MeshComponent->IsPendingKill())
+					continue;
+
+				for (int32 SlotIdx = 0; SlotIdx < MeshComponent->GetNumMaterials(); SlotIdx++)
+				{
+					UMaterialInterface* Material = MeshComponent->GetMaterial(SlotIdx);
+					if (!Material || Material == PlaceholderMaterial)
+						continue;
+
+					if (!FHoudiniMaterialTranslator::IsMaterialCompiling(Material))
+						continue;
+
+					FHoudiniGatedMaterialSlot& GatedSlot = Gate.Slots.AddDefaulted_GetRef();
+					GatedSlot.Component = MeshComponent;
+					GatedSlot.SlotIndex = SlotIdx;
+					GatedSlot.Material = Material;
+					if (MeshComponent->OverrideMaterials.IsValidIndex(SlotIdx))
+						GatedSlot.OriginalOverride = MeshComponent->OverrideMaterials[SlotIdx];
+
+					MeshComponent->SetMaterial(SlotIdx, PlaceholderMaterial);
+					CompilingMaterials.Add(Material);
+				}
+			}
+		}
+	}
+
+	if (Gate.Slots.Num() <= 0)
+		return;
+
+	Gate.DisplayName = HAC->GetDisplayName();
+	Gate.NumMaterials = CompilingMaterials.Num();
+	Gate.StartTime = FPlatformTime::Seconds();
+
+#if WITH_EDITOR
+	const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+	if (HoudiniRuntimeSettings && HoudiniRuntimeSettings->bDisplaySlateCookingNotifications)
+	{
+		FString Notification = FString::Format(TEXT("{0}: compiling materials 0 / {1}..."), { Gate.DisplayName, FString::FromInt(Gate.NumMaterials) });
+		FNotificationInfo Info(FText::FromString(Notification));
+		Info.bFireAndForget = false;
+		TSharedPtr<FSlateDynamicImageBrush> HoudiniBrush = FHoudiniEngine::Get().GetHoudiniEngineLogoBrush();
+		if (HoudiniBrush.IsValid())
+			Info.Image = HoudiniBrush.Get();
+
+		Gate.Notification = FSlateNotificationManager::Get().AddNotification(Info);
+	}
+#endif
+
+	MaterialCompileGates.Add(HAC, Gate);
+}
+
+void
+FHoudiniEngineManager::ReleaseCompilingMaterials(UHoudiniAssetComponent* HAC)
+{
+	for (auto Iter = MaterialCompileGates.CreateIterator(); Iter; ++Iter)
+	{
+		if (HAC && Iter.Key().Get() != HAC)
+			continue;
+
+		for (const FHoudiniGatedMaterialSlot& CurSlot : Iter.Value().Slots)
+			RestoreGatedMaterialSlot(CurSlot);
+
+		FinishMaterialCompileGate(Iter.Value());
+		Iter.RemoveCurrent();
+	}
+}
+
+void
+FHoudiniEngineManager::UpdateCompilingMaterials()
+{
+	if (MaterialCompileGates.Num() <= 0)
+		return;
+
+	int32 NumCompilingMaterials = 0;
+	for (auto Iter = MaterialCompileGates.CreateIterator(); Iter; ++Iter)
+	{
+		FHoudiniMaterialCompileGate& Gate = Iter.Value();
+
+		// Swap in the materials that are done compiling
+		TSet<UMaterialInterface*> CompilingMaterials;
+		for (int32 SlotIdx = Gate.Slots.Num() - 1; SlotIdx >= 0; SlotIdx--)
+		{
+			const FHoudiniGatedMaterialSlot& CurSlot = Gate.Slots[SlotIdx];
+			UMaterialInterface* Material = CurSlot.Material.Get();
+			if (CurSlot.Component.IsValid() && FHoudiniMaterialTranslator::IsMaterialCompiling(Material))
+			{
+				CompilingMaterials.Add(Material);
+				continue;
+			}
+
+			RestoreGatedMaterialSlot(CurSlot);
+			Gate.Slots.RemoveAtSwap(SlotIdx);
+		}
+
+		if (!Iter.Key().IsValid() || Gate.Slots.Num() <= 0)
+		{
+			for (const FHoudiniGatedMaterialSlot& CurSlot : Gate.Slots)
+				RestoreGatedMaterialSlot(CurSlot);
+
+			FinishMaterialCompileGate(Gate);
+			Iter.RemoveCurrent();
+			continue;
+		}
+
+		NumCompilingMaterials += CompilingMaterials.Num();
+
+#if WITH_EDITOR
+		TSharedPtr<SNotificationItem> NotificationItem = Gate.Notification.Pin();
+		if (NotificationItem.IsValid())
+		{
+			int32 NumCompiled = FMath::Max(Gate.NumMaterials - CompilingMaterials.Num(), 0);
+			FString Notification = FString::Format(TEXT("{0}: compiling materials {1} / {2}..."),
+				{ Gate.DisplayName, FString::FromInt(NumCompiled), FString::FromInt(Gate.NumMaterials) });
+			NotificationItem->SetText(FText::FromString(Notification));
+		}
+#endif
+	}
+
+	SET_DWORD_STAT(STAT_HoudiniCompilingOutputMaterials, NumCompilingMaterials);
+}
+
+void
+FHoudiniEngineManager::RestoreGatedMaterialSlot(const FHoudiniGatedMaterialSlot& InSlot)
+{
+	UMeshComponent* MeshComponent = InSlot.Component.Get();
+	if (!MeshComponent || MeshComponent->IsPendingKill())
+		return;
+
+	// Leave the slot alone if its material has been changed since it was gated
+	if (!MeshComponent->OverrideMaterials.IsValidIndex(InSlot.SlotIndex))
+		return;
+
+	UMaterialInterface* PlaceholderMaterial = FHoudiniEngine::Get().GetHoudiniDefaultMaterial().Get();
+	if (MeshComponent->OverrideMaterials[InSlot.SlotIndex] != PlaceholderMaterial)
+		return;
+
+	MeshComponent->SetMaterial(InSlot.SlotIndex, InSlot.OriginalOverride.Get());
+}
+
+void
+FHoudiniEngineManager::FinishMaterialCompileGate(FHoudiniMaterialCompileGate& InGate)
+{
+	const double WaitTime = FPlatformTime::Seconds() - InGate.StartTime;
+	INC_FLOAT_STAT_BY(STAT_HoudiniMaterialCompileWaitTime, (float)WaitTime);
+
+	HOUDINI_LOG_MESSAGE(TEXT("%s: %d generated material(s) compiled in %.3f s."), *InGate.DisplayName, InGate.NumMaterials, WaitTime);
+
+#if WITH_EDITOR
+	TSharedPtr<SNotificationItem> NotificationItem = InGate.Notification.Pin();
+	if (NotificationItem.IsValid())
+	{
+		FString Notification = FString::Format(TEXT("{0}: finished compiling materials"), { InGate.DisplayName });
+		NotificationItem->SetText(FText::FromString(Notification));
+		NotificationItem->ExpireAndFadeout();
+	}
+#endif
+
+	InGate.Notification.Reset();
+}
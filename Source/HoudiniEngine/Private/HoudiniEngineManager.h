@@ -37,6 +37,9 @@
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
+class UMeshComponent;
+class UMaterialInterface;
+class SNotificationItem;
 
 struct FHoudiniEngineTaskInfo;
 struct FGuid;
@@ -61,6 +64,13 @@ public:
 	// This is fired by the OnRefinedMeshesTimerDelegate on a HAC
 	void BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniAssetComponent* HAC);
 
+	// Assigns a placeholder material to the HAC's output component slots whose material is still compiling.
+	// The compiled materials are swapped back in by the manager's tick.
+	void GateCompilingMaterials(UHoudiniAssetComponent* HAC);
+
+	// Restores the material slots gated for the given HAC, or for all HACs if null
+	void ReleaseCompilingMaterials(UHoudiniAssetComponent* HAC);
+
 	void StartPDGCommandlet()
 	{
 		if (!IsPDGCommandletRunningOrConnected())
@@ -140,8 +150,37 @@ protected:
 
 	void EnableEditorAutoSave(const UHoudiniAssetComponent* HAC);
 
+	// Swaps in the gated materials that have finished compiling and updates the progress notifications
+	void UpdateCompilingMaterials();
+
 private:
 
+	// A component material slot that uses a placeholder while its material is compiling
+	struct FHoudiniGatedMaterialSlot
+	{
+		TWeakObjectPtr<UMeshComponent> Component;
+		int32 SlotIndex = INDEX_NONE;
+		TWeakObjectPtr<UMaterialInterface> Material;
+		// Override material of the slot before it was gated
+		TWeakObjectPtr<UMaterialInterface> OriginalOverride;
+	};
+
+	// The gated material slots of a HAC
+	struct FHoudiniMaterialCompileGate
+	{
+		TArray<FHoudiniGatedMaterialSlot> Slots;
+		FString DisplayName;
+		int32 NumMaterials = 0;
+		double StartTime = 0.0;
+		TWeakPtr<SNotificationItem> Notification;
+	};
+
+	// Restores a slot's material if it still uses the placeholder
+	static void RestoreGatedMaterialSlot(const FHoudiniGatedMaterialSlot& InSlot);
+
+	// Records the compile wait time of a gate and closes its notification
+	static void FinishMaterialCompileGate(FHoudiniMaterialCompileGate& InGate);
+
 	// Ticker handle, used for processing HAC.
 	FDelegateHandle TickerHandle;
 
@@ -176,4 +215,7 @@ private:
 
 	// Indicates which HACs disable auto-saving
 	TSet<const UHoudiniAssetComponent*> DisableAutoSavingHACs;
+
+	// HACs waiting for their generated materials to be compiled
+	TMap<TWeakObjectPtr<UHoudiniAssetComponent>, FHoudiniMaterialCompileGate> MaterialCompileGates;
 };
\ No newline at end of file
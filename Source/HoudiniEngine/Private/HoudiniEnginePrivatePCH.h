@@ -179,11 +179,13 @@
 #define HAPI_UNREAL_ATTRIB_INSTANCE							"instance"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE				"unreal_instance"
 #define HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES					"unreal_split_instances"
+#define HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES_COLLAPSE			"unreal_split_instances_collapse"
 #define HAPI_UNREAL_ATTRIB_FOLIAGE_INSTANCER				"unreal_foliage"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_ROTATION				"rot"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_SCALE					"scale"
 #define HAPI_UNREAL_ATTRIB_INSTANCE_POSITION				HAPI_ATTRIB_POSITION
 #define HAPI_UNREAL_ATTRIB_INSTANCE_COLOR					"unreal_instance_color"
+#define HAPI_UNREAL_ATTRIB_INSTANCE_CUSTOM_DATA_PREFIX		"unreal_per_instance_custom_data"
 #define HAPI_UNREAL_ATTRIB_SPLIT_ATTR						"unreal_split_attr"
 #define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCED_SM		"unreal_hierarchical_instancer"
 
@@ -269,6 +271,7 @@
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_OBJECT               TEXT( "HoudiniGeneratedObject" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_NAME                 TEXT( "HoudiniGeneratedName" )
 #define HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE         TEXT( "HoudiniGeneratedTextureType" )
+#define HAPI_UNREAL_PACKAGE_META_MATERIAL_PARAMETERS_HASH       TEXT( "HoudiniMaterialParametersHash" )
 #define HAPI_UNREAL_PACKAGE_META_NODE_PATH                      TEXT( "HoudiniNodePath" )
 #define HAPI_UNREAL_PACKAGE_META_BAKE_COUNTER                   TEXT( "HoudiniPackageBakeCounter" )
 #define HAPI_UNREAL_PACKAGE_META_TEMP_GUID                      TEXT( "HoudiniPackageTempGUID" )
@@ -364,3 +367,15 @@
 #define HAPI_UNREAL_NOTIFICATION_FADEOUT				2.0f
 #define HAPI_UNREAL_NOTIFICATION_EXPIRE					2.0f
 
+// Number of instances per chunk when tracking changes in an instancer input's transforms
+#define HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE			1024
+
+// Maximum distance (in cm) between an Unreal spline and its sampled curve before a segment is subdivided
+#define HAPI_UNREAL_SPLINE_SAMPLING_TOLERANCE			1.0f
+// Maximum angle (in degrees) between two consecutive samples' rotations before a segment is subdivided
+#define HAPI_UNREAL_SPLINE_SAMPLING_ANGLE_TOLERANCE		2.0f
+// Maximum number of subdivisions of a spline segment when sampling an Unreal spline
+#define HAPI_UNREAL_SPLINE_SAMPLING_MAX_DEPTH			16
+
+// Time budget (in seconds) for spawning instanced actors per tick, the remaining actors are spawned on the next ticks
+#define HAPI_UNREAL_INSTANCED_ACTOR_SPAWN_BUDGET		0.005
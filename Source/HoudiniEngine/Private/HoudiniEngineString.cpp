@@ -212,4 +212,61 @@ FHoudiniEngineString::SHArrayToFStringArray(const TArray<int32>& InStringIdArray
 	}
 
 	return bReturn;
+}
+
+bool
+FHoudiniEngineString::SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray)
+{
+	OutStringArray.SetNumZeroed(InStringIdArray.Num());
+	if (InStringIdArray.Num() <= 0)
+		return true;
+
+	// Only resolve each string once
+	TArray<int32> UniqueStringIds;
+	TMap<HAPI_StringHandle, int32> UniqueIndices;
+	for (const int32& StringId : InStringIdArray)
+	{
+		if (!UniqueIndices.Contains(StringId))
+			UniqueIndices.Add(StringId, UniqueStringIds.Add(StringId));
+	}
+
+	int32 BufferSize = 0;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatchSize(
+		FHoudiniEngine::Get().GetSession(),
+		UniqueStringIds.GetData(), UniqueStringIds.Num(), &BufferSize))
+	{
+		return false;
+	}
+
+	if (BufferSize <= 0)
+		return false;
+
+	TArray<char> Buffer;
+	Buffer.SetNumZeroed(BufferSize);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStringBatch(
+		FHoudiniEngine::Get().GetSession(), Buffer.GetData(), BufferSize))
+	{
+		return false;
+	}
+
+	// The batch contains the null-terminated strings, in the order of the handles
+	TArray<FString> UniqueStrings;
+	UniqueStrings.Reserve(UniqueStringIds.Num());
+	int32 StringStart = 0;
+	for (int32 CharIdx = 0; CharIdx < BufferSize && UniqueStrings.Num() < UniqueStringIds.Num(); CharIdx++)
+	{
+		if (Buffer[CharIdx] != '\0')
+			continue;
+
+		UniqueStrings.Add(UTF8_TO_TCHAR(&Buffer[StringStart]));
+		StringStart = CharIdx + 1;
+	}
+
+	if (UniqueStrings.Num() != UniqueStringIds.Num())
+		return false;
+
+	for (int32 IdxSH = 0; IdxSH < InStringIdArray.Num(); IdxSH++)
+		OutStringArray[IdxSH] = UniqueStrings[UniqueIndices[InStringIdArray[IdxSH]]];
+
+	return true;
 }
\ No newline at end of file
@@ -61,6 +61,9 @@ class HOUDINIENGINE_API FHoudiniEngineString
 		// Array converter, uses a map to avoid redudant calls to HAPI
 		static bool SHArrayToFStringArray(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
 
+		// Array converter, resolves all the unique strings with a single HAPI string batch
+		static bool SHArrayToFStringArray_Batch(const TArray<int32>& InStringIdArray, TArray<FString>& OutStringArray);
+
 		// Return id of this string.
 		int32 GetId() const;
 
@@ -66,6 +66,7 @@
 #include "Modules/ModuleManager.h"
 #include "Engine/StaticMeshSocket.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 #include "BlueprintEditor.h"
 #include "Toolkits/AssetEditorManager.h"
 #include "Engine/BlueprintGeneratedClass.h"
@@ -1693,6 +1694,17 @@ FHoudiniEngineUtils::TranslateHapiTransform(const HAPI_TransformEuler & HapiTran
 	FHoudiniEngineUtils::TranslateHapiTransform(HapiTransformQuat, UnrealTransform);
 }
 
+void
+FHoudiniEngineUtils::TranslateHapiTransforms(const TArray<HAPI_Transform>& HapiTransforms, TArray<FTransform>& UnrealTransforms)
+{
+	// Every transform is written, no need to initialize them
+	UnrealTransforms.SetNumUninitialized(HapiTransforms.Num());
+	ParallelFor(HapiTransforms.Num(), [&](int32 Idx)
+	{
+		TranslateHapiTransform(HapiTransforms[Idx], UnrealTransforms[Idx]);
+	});
+}
+
 void
 FHoudiniEngineUtils::TranslateUnrealTransform(const FTransform & UnrealTransform, HAPI_Transform & HapiTransform)
 {
@@ -2591,7 +2603,19 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
 
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	HAPI_AttributeOwner ManifestOwner = HAPI_ATTROWNER_INVALID;
+	if (FindAttributeOwnerInManifest(InGeoId, InPartId, InAttribName, InOwner, ManifestOwner))
+	{
+		// The part's manifest tells us which owner has the attribute, if any
+		if (ManifestOwner == HAPI_ATTROWNER_INVALID)
+			return false;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, InAttribName,
+			ManifestOwner, &AttributeInfo), false);
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -2706,7 +2730,19 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsInteger(
 
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	HAPI_AttributeOwner ManifestOwner = HAPI_ATTROWNER_INVALID;
+	if (FindAttributeOwnerInManifest(InGeoId, InPartId, InAttribName, InOwner, ManifestOwner))
+	{
+		// The part's manifest tells us which owner has the attribute, if any
+		if (ManifestOwner == HAPI_ATTROWNER_INVALID)
+			return false;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, InAttribName,
+			ManifestOwner, &AttributeInfo), false);
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -2822,7 +2858,19 @@ FHoudiniEngineUtils::HapiGetAttributeDataAsString(
 
 	HAPI_AttributeInfo AttributeInfo;
 	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (InOwner == HAPI_ATTROWNER_INVALID)
+	HAPI_AttributeOwner ManifestOwner = HAPI_ATTROWNER_INVALID;
+	if (FindAttributeOwnerInManifest(InGeoId, InPartId, InAttribName, InOwner, ManifestOwner))
+	{
+		// The part's manifest tells us which owner has the attribute, if any
+		if (ManifestOwner == HAPI_ATTROWNER_INVALID)
+			return false;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartId, InAttribName,
+			ManifestOwner, &AttributeInfo), false);
+	}
+	else if (InOwner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 AttrIdx = 0; AttrIdx < HAPI_ATTROWNER_MAX; ++AttrIdx)
 		{
@@ -2943,6 +2991,11 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	const HAPI_NodeId& GeoId, const HAPI_PartId& PartId,
 	const char * AttribName, HAPI_AttributeOwner Owner)
 {
+	// Answer from the part's manifest if we have one
+	HAPI_AttributeOwner ManifestOwner = HAPI_ATTROWNER_INVALID;
+	if (FindAttributeOwnerInManifest(GeoId, PartId, AttribName, Owner, ManifestOwner))
+		return ManifestOwner != HAPI_ATTROWNER_INVALID;
+
 	if (Owner == HAPI_ATTROWNER_INVALID)
 	{
 		for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
@@ -2968,6 +3021,115 @@ FHoudiniEngineUtils::HapiCheckAttributeExists(
 	return false;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetAttributeManifest(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartInfo& InPartInfo,
+	FHoudiniAttributeManifest& OutManifest)
+{
+	static_assert(FHoudiniAttributeManifest::NumOwners == HAPI_ATTROWNER_MAX, "The manifest needs one entry per attribute owner.");
+
+	OutManifest.Reset();
+
+	// Get the name handles of all the owners first, so they can be resolved in one batch
+	TArray<HAPI_StringHandle> AttributeNameHandles;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 AttributeCount = InPartInfo.attributeCounts[OwnerIdx];
+		if (AttributeCount <= 0)
+			continue;
+
+		const int32 FirstHandleIdx = AttributeNameHandles.AddUninitialized(AttributeCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeNames(
+			FHoudiniEngine::Get().GetSession(),
+			InGeoId, InPartInfo.id, (HAPI_AttributeOwner)OwnerIdx,
+			&AttributeNameHandles[FirstHandleIdx], AttributeCount), false);
+	}
+
+	TArray<FString> AttributeNames;
+	if (!FHoudiniEngineString::SHArrayToFStringArray_Batch(AttributeNameHandles, AttributeNames))
+		return false;
+
+	int32 NameIdx = 0;
+	for (int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; OwnerIdx++)
+	{
+		const int32 AttributeCount = FMath::Max(InPartInfo.attributeCounts[OwnerIdx], 0);
+		for (int32 Idx = 0; Idx < AttributeCount; Idx++)
+			OutManifest.AttributeNames[OwnerIdx].Add(AttributeNames[NameIdx++]);
+	}
+
+	OutManifest.bIsValid = true;
+	return true;
+}
+
+// The registered attribute manifests, per geo and part, and the number of active manifest scopes
+static TMap<TPair<HAPI_NodeId, HAPI_PartId>, TSharedPtr<const FHoudiniAttributeManifest>> RegisteredAttributeManifests;
+static int32 AttributeManifestScopeCount = 0;
+
+void
+FHoudiniEngineUtils::RegisterAttributeManifest(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const TSharedPtr<const FHoudiniAttributeManifest>& InManifest)
+{
+	if (AttributeManifestScopeCount <= 0 || !InManifest.IsValid() || !InManifest->bIsValid || !IsInGameThread())
+		return;
+
+	RegisteredAttributeManifests.Add(TPair<HAPI_NodeId, HAPI_PartId>(InGeoId, InPartId), InManifest);
+}
+
+bool
+FHoudiniEngineUtils::FindAttributeOwnerInManifest(
+	const HAPI_NodeId& InGeoId,
+	const HAPI_PartId& InPartId,
+	const char * InAttribName,
+	const HAPI_AttributeOwner& InOwner,
+	HAPI_AttributeOwner& OutOwner)
+{
+	OutOwner = HAPI_ATTROWNER_INVALID;
+
+	// The manifests are only used on the game thread
+	if (AttributeManifestScopeCount <= 0 || !IsInGameThread())
+		return false;
+
+	const TSharedPtr<const FHoudiniAttributeManifest>* FoundManifest = RegisteredAttributeManifests.Find(TPair<HAPI_NodeId, HAPI_PartId>(InGeoId, InPartId));
+	if (!FoundManifest || !FoundManifest->IsValid() || !(*FoundManifest)->bIsValid)
+		return false;
+
+	const FHoudiniAttributeManifest* Manifest = FoundManifest->Get();
+
+	const FString AttribName(InAttribName);
+	if (InOwner == HAPI_ATTROWNER_INVALID)
+	{
+		const int32 FoundOwner = Manifest->FindAttributeOwner(AttribName);
+		if (FoundOwner >= 0)
+			OutOwner = (HAPI_AttributeOwner)FoundOwner;
+	}
+	else if (Manifest->HasAttribute(AttribName, (int32)InOwner))
+	{
+		OutOwner = InOwner;
+	}
+
+	return true;
+}
+
+FHoudiniAttributeManifestScope::FHoudiniAttributeManifestScope()
+{
+	check(IsInGameThread());
+	AttributeManifestScopeCount++;
+}
+
+FHoudiniAttributeManifestScope::~FHoudiniAttributeManifestScope()
+{
+	check(IsInGameThread());
+	AttributeManifestScopeCount--;
+	if (AttributeManifestScopeCount <= 0)
+	{
+		AttributeManifestScopeCount = 0;
+		RegisteredAttributeManifests.Empty();
+	}
+}
+
 bool
 FHoudiniEngineUtils::IsAttributeInstancer(const HAPI_NodeId& GeoId, const HAPI_PartId& PartId, EHoudiniInstancerType& OutInstancerType)
 {
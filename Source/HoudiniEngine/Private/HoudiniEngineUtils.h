@@ -124,6 +124,9 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// HAPI : Translate HAPI Euler transform to Unreal one.
 		static void TranslateHapiTransform(const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform);
 
+		// HAPI : Translate an array of HAPI transforms to Unreal ones, in parallel.
+		static void TranslateHapiTransforms(const TArray<HAPI_Transform>& HapiTransforms, TArray<FTransform>& UnrealTransforms);
+
 		// HAPI : Translate Unreal transform to HAPI one.
 		static void TranslateUnrealTransform(const FTransform & UnrealTransform, HAPI_Transform & HapiTransform);
 
@@ -214,6 +217,29 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			const char * AttribName,
 			HAPI_AttributeOwner Owner = HAPI_ATTROWNER_INVALID);
 
+		// HAPI : Gets the names of all the attributes of a part, with one call per owner and a single string batch.
+		static bool HapiGetAttributeManifest(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartInfo& InPartInfo,
+			FHoudiniAttributeManifest& OutManifest);
+
+		// Makes a part's attribute manifest available to the attribute helpers until the end of the current
+		// FHoudiniAttributeManifestScope. Does nothing if no scope is active.
+		static void RegisterAttributeManifest(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const TSharedPtr<const FHoudiniAttributeManifest>& InManifest);
+
+		// Uses the part's registered manifest to find which owner has the attribute, without querying HAPI.
+		// Returns false if there is no manifest for the part. OutOwner is HAPI_ATTROWNER_INVALID if the attribute
+		// doesn't exist (on InOwner if it is valid).
+		static bool FindAttributeOwnerInManifest(
+			const HAPI_NodeId& InGeoId,
+			const HAPI_PartId& InPartId,
+			const char * InAttribName,
+			const HAPI_AttributeOwner& InOwner,
+			HAPI_AttributeOwner& OutOwner);
+
 		// HAPI: Returns all the attributes of a given type for a given owner
 		static int32 HapiGetAttributeOfType(
 			const HAPI_NodeId& GeoId,
@@ -621,4 +647,13 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		// Trigger an update of the Blueprint Editor on the game thread
 		static void UpdateBlueprintEditor_Internal(UHoudiniAssetComponent* HAC);
 
+};
+
+// While a scope is alive, the attribute manifests registered via FHoudiniEngineUtils::RegisterAttributeManifest
+// answer the attribute existence and owner queries. They are discarded when the outermost scope ends,
+// so a scope should not outlive the cook the manifests were gathered for.
+struct HOUDINIENGINE_API FHoudiniAttributeManifestScope
+{
+	FHoudiniAttributeManifestScope();
+	~FHoudiniAttributeManifestScope();
 };
\ No newline at end of file
@@ -1069,6 +1069,14 @@ FHoudiniInputTranslator::UploadInputTransform(UHoudiniInput* InInput)
 		}
 	}
 
+	// Instancers that couldn't be updated in place have been marked as changed,
+	// fall back to a full data upload to recreate their input nodes
+	if (InInput->IsDataUploadNeeded())
+	{
+		bSuccess = UploadInputData(InInput);
+		InInput->MarkDataUploadNeeded(!bSuccess);
+	}
+
 	return bSuccess;
 }
 
@@ -1366,7 +1374,34 @@ FHoudiniInputTranslator::UploadHoudiniInputTransform(
 
 		case EHoudiniInputObjectType::InstancedStaticMeshComponent:
 		{
-			// TODO: Only update the instances transform
+			UHoudiniInputInstancedMeshComponent* InISMC = Cast<UHoudiniInputInstancedMeshComponent>(InInputObject);
+			if (!InISMC || InISMC->IsPendingKill())
+			{
+				bSuccess = false;
+				break;
+			}
+
+			UInstancedStaticMeshComponent* ISMC = InISMC->GetInstancedStaticMeshComponent();
+			if (!ISMC || ISMC->IsPendingKill())
+				break;
+
+			// Only upload the instances that have changed since the last upload.
+			// Added/removed instances are handled by the data upload, which rebuilds the instancer.
+			if (!FUnrealInstanceTranslator::HapiUpdateInputNodeForInstancer(
+				ISMC, InISMC->InputNodeId, InISMC->InstanceTransforms.Num(), InISMC->InstanceChunkHashes))
+			{
+				// The instancer needs to be rebuilt, invalidate its hashes
+				// and mark it as changed so the data upload recreates it
+				InISMC->InstanceChunkHashes.Empty();
+				InISMC->MarkChanged(true);
+				InInput->MarkDataUploadNeeded(true);
+				bSuccess = false;
+				break;
+			}
+
+			// Update the component's cached instances
+			InISMC->Update(ISMC);
+
 			break;
 		}
 
@@ -1939,9 +1974,21 @@ FHoudiniInputTranslator::HapiCreateInputNodeForInstancedStaticMeshComponent(
 	if (!ISMC || ISMC->IsPendingKill())
 		return true;
 
+	// The instancer is rebuilt entirely, delete the previous one if any
+	if (InObject->InputObjectNodeId >= 0 && InObject->CanDeleteHoudiniNodes())
+	{
+		if (FHoudiniEngineUtils::IsHoudiniNodeValid(InObject->InputObjectNodeId))
+		{
+			HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
+				FHoudiniEngine::Get().GetSession(), InObject->InputObjectNodeId));
+		}
+		InObject->InputNodeId = -1;
+		InObject->InputObjectNodeId = -1;
+	}
+
 	HAPI_NodeId NewNodeId = -1;
 	if (!FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
-		ISMC, InObjNodeName, NewNodeId, bExportLODs, bExportSockets, bExportColliders, false))
+		ISMC, InObjNodeName, NewNodeId, bExportLODs, bExportSockets, bExportColliders, false, InObject->InstanceChunkHashes))
 		return false;
 
 	// Update this input object's node IDs
@@ -1971,7 +2018,7 @@ FHoudiniInputTranslator::HapiCreateInputNodeForSplineComponent(const FString& In
 
 	FString NodeName = InObjNodeName + TEXT("_") + InObject->GetName();
 
-	if (!FUnrealSplineTranslator::CreateInputNodeForSplineComponent(Spline, SplineResolution, InObject->InputNodeId, NodeName))
+	if (!FUnrealSplineTranslator::CreateInputNodeForSplineComponent(Spline, SplineResolution, InObject->InputNodeId, NodeName, InObject))
 		return false;
 
 	// Cache the exported curve's data to the input object
@@ -2267,7 +2314,24 @@ FHoudiniInputTranslator::HapiCreateInputNodeForLandscape(
 	bool bSucess = false;
 	if (ExportType == EHoudiniLandscapeExportType::Heightfield)
 	{
-		bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName);
+		// Try to only upload the landscape components that have changed to the existing heightfield first
+		bSucess = FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(Landscape, InObject);
+		if (!bSucess)
+		{
+			// The heightfield needs to be rebuilt, delete the previous one
+			if (InObject->InputObjectNodeId >= 0 && InObject->CanDeleteHoudiniNodes()
+				&& FHoudiniEngineUtils::IsHoudiniNodeValid(InObject->InputObjectNodeId))
+			{
+				HOUDINI_CHECK_ERROR(FHoudiniApi::DeleteNode(
+					FHoudiniEngine::Get().GetSession(), InObject->InputObjectNodeId));
+			}
+			InObject->InputNodeId = -1;
+			InObject->InputObjectNodeId = -1;
+			InObject->CachedComponentHashes.Empty();
+			InObject->CachedVolumeNodeIds.Empty();
+
+			bSucess = FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(Landscape, InObject->InputNodeId, InObjNodeName, InObject);
+		}
 	}
 	else
 	{
@@ -28,10 +28,12 @@
 
 #include "HoudiniEngine.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineString.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "HoudiniMeshSplitInstancerComponent.h"
+#include "HoudiniObjectPathCache.h"
 #include "HoudiniStaticMeshComponent.h"
 #include "HoudiniStaticMesh.h"
 
@@ -43,6 +45,8 @@
 #include "Components/InstancedStaticMeshComponent.h"
 #include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "InstancedFoliageActor.h"
+#include "Async/ParallelFor.h"
+#include "Containers/Ticker.h"
 
 #if WITH_EDITOR
 	//#include "ScopedTransaction.h"
@@ -76,6 +80,8 @@ FHoudiniInstanceTranslator::PopulateInstancedOutputPartData(
 			InAllOutputs,
 			OutInstancedOutputPartData.OriginalInstancedObjects,
 			OutInstancedOutputPartData.OriginalInstancedTransforms,
+			OutInstancedOutputPartData.OriginalInstancedCustomData,
+			OutInstancedOutputPartData.NumCustomDataFloats,
 			OutInstancedOutputPartData.SplitAttributeName,
 			OutInstancedOutputPartData.SplitAttributeValues,
 			OutInstancedOutputPartData.PerSplitAttributes))
@@ -161,7 +167,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 	// the UI (foliage mode) at the end
 	bool bHaveAnyFoliageInstancers = false;
 
-	// We also need to cleanup the previous foliages instances (if we have any)
+	// The previous foliage instances are diffed by the update, only the foliage components
+	// that aren't reused by this cook will have their instances cleaned up afterwards
 	for (auto& CurrentPair : OldOutputObjects)
 	{
 		// Foliage instancers store a HISMC in the components
@@ -169,8 +176,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		if (!FoliageHISMC || FoliageHISMC->IsPendingKill())
 			continue;
 
-		CleanupFoliageInstances(FoliageHISMC, ParentComponent);
-		bHaveAnyFoliageInstancers = true;
+		if (FoliageHISMC->GetOwner() && FoliageHISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+			bHaveAnyFoliageInstancers = true;
 	}
 
 	// The default SM to be used if the instanced object has not been found (when using attribute instancers)
@@ -231,6 +238,8 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		TArray<TSoftObjectPtr<UObject>> VariationInstancedObjects;
 		// Array containing all the variations transforms
 		TArray<TArray<FTransform>> VariationInstancedTransforms;
+		// Array containing all the variations per-instance custom data
+		TArray<TArray<float>> VariationInstancedCustomData;
 		// Array indicate the original object index for each variation
 		TArray<int32> VariationOriginalObjectIndices;
 		// Array indicate the variation number for each variation
@@ -239,8 +248,11 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		UpdateInstanceVariationObjects(
 			OutputIdentifier,
 			InstancedOutputPartData.OriginalInstancedObjects,
-			InstancedOutputPartData.OriginalInstancedTransforms, InOutput->GetInstancedOutputs(),
-			VariationInstancedObjects, VariationInstancedTransforms, 
+			InstancedOutputPartData.OriginalInstancedTransforms,
+			InstancedOutputPartData.OriginalInstancedCustomData,
+			InstancedOutputPartData.NumCustomDataFloats,
+			InOutput->GetInstancedOutputs(),
+			VariationInstancedObjects, VariationInstancedTransforms, VariationInstancedCustomData,
 			VariationOriginalObjectIndices, VariationIndices);
 
 		// Create the instancer components now
@@ -303,7 +315,10 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				InstancedOutputPartData.bSplitMeshInstancer,
 				InstancedOutputPartData.bIsFoliageInstancer,
 				VariationMaterials,
-				InstancedOutputPartData.bForceHISM))
+				0,
+				InstancedOutputPartData.bForceHISM,
+				VariationInstancedCustomData[InstanceObjectIdx],
+				InstancedOutputPartData.NumCustomDataFloats))
 			{
 				// TODO??
 				continue;
@@ -423,6 +438,11 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 		}
 	}
 
+	// Foliage components are shared by all the outputs using the same foliage type
+	TSet<UObject*> NewComponents;
+	for (const auto& CurNewPair : NewOutputObjects)
+		NewComponents.Add(CurNewPair.Value.OutputComponent);
+
 	// The Old map now only contains unused/stale components, delete them
 	for (auto& OldPair : OldOutputObjects)
 	{
@@ -437,7 +457,13 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(
 				// When destroying a component, we have to be sure it's not an HISMC owned by an InstanceFoliageActor
 				UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(OldComponent);
 				if (HISMC->GetOwner() && HISMC->GetOwner()->IsA<AInstancedFoliageActor>())
+				{
 					bDestroy = false;
+
+					// Remove the instances of the foliage types that aren't used anymore
+					if (!NewComponents.Contains(HISMC))
+						CleanupFoliageInstances(HISMC, ParentComponent);
+				}
 			}
 
 			if(bDestroy)
@@ -491,18 +517,26 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 	TArray<TArray<FTransform>> OriginalInstancedTransforms;
 	OriginalInstancedTransforms.Add(InInstancedOutput.OriginalTransforms);
 
+	TArray<TArray<float>> OriginalInstancedCustomData;
+	OriginalInstancedCustomData.Add(InInstancedOutput.OriginalCustomData);
+	const int32 NumCustomDataFloats = InInstancedOutput.NumCustomDataFloats;
+
 	// Update our variations using the changed instancedoutputs objects
 	TArray<TSoftObjectPtr<UObject>> InstancedObjects;
 	TArray<TArray<FTransform>> InstancedTransforms;
+	TArray<TArray<float>> InstancedCustomData;
 	TArray<int32> VariationOriginalObjectIndices;
 	TArray<int32> VariationIndices;
 	UpdateInstanceVariationObjects(
 		OutputIdentifier,
 		OriginalInstancedObjects,
 		OriginalInstancedTransforms,
+		OriginalInstancedCustomData,
+		NumCustomDataFloats,
 		InParentOutput->GetInstancedOutputs(),
 		InstancedObjects,
 		InstancedTransforms,
+		InstancedCustomData,
 		VariationOriginalObjectIndices,
 		VariationIndices);
 
@@ -590,7 +624,8 @@ FHoudiniInstanceTranslator::UpdateChangedInstancedOutput(
 			InstancedObject, InstancedObjectTransforms,
 			AllPropertyAttributes, HGPO,
 			InParentComponent, OldInstancerComponent, NewInstancerComponent,
-			bSplitMeshInstancer, bIsFoliageInstancer, InstancerMaterials, bForceHISM))
+			bSplitMeshInstancer, bIsFoliageInstancer, InstancerMaterials, 0, bForceHISM,
+			InstancedCustomData[InstanceObjectIdx], NumCustomDataFloats))
 		{
 			// TODO??
 			continue;
@@ -655,6 +690,8 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 	const TArray<UHoudiniOutput*>& InAllOutputs,
 	TArray<UObject*>& OutInstancedObjects,
 	TArray<TArray<FTransform>>& OutInstancedTransforms,
+	TArray<TArray<float>>& OutInstancedCustomData,
+	int32& OutNumCustomDataFloats,
 	FString& OutSplitAttributeName,
 	TArray<FString>& OutSplitAttributeValues,
 	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
@@ -662,6 +699,10 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 	TArray<UObject*> InstancedObjects;
 	TArray<TArray<FTransform>> InstancedTransforms;
 
+	// Only attribute instancers support per-instance custom data
+	TArray<TArray<float>> InstancedCustomData;
+	int32 NumCustomDataFloats = 0;
+
 	TArray<FHoudiniGeoPartObject> InstancedHGPOs;
 	TArray<TArray<FTransform>> InstancedHGPOTransforms;
 
@@ -688,6 +729,8 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 				InHGPO,
 				InstancedObjects,
 				InstancedTransforms,
+				InstancedCustomData,
+				NumCustomDataFloats,
 				OutSplitAttributeName,
 				OutSplitAttributeValues,
 				OutPerSplitAttributes);
@@ -768,8 +811,18 @@ FHoudiniInstanceTranslator::GetInstancerObjectsAndTransforms(
 		return false;
 	}
 
-	OutInstancedObjects = InstancedObjects;
-	OutInstancedTransforms = InstancedTransforms;
+	// Keep one custom data array per instanced object
+	if (NumCustomDataFloats <= 0 || InstancedCustomData.Num() != InstancedObjects.Num())
+	{
+		NumCustomDataFloats = 0;
+		InstancedCustomData.Empty();
+	}
+	InstancedCustomData.SetNum(InstancedObjects.Num());
+
+	OutInstancedObjects = MoveTemp(InstancedObjects);
+	OutInstancedTransforms = MoveTemp(InstancedTransforms);
+	OutInstancedCustomData = MoveTemp(InstancedCustomData);
+	OutNumCustomDataFloats = NumCustomDataFloats;
 
 	return true;
 }
@@ -780,9 +833,12 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 	const FHoudiniOutputObjectIdentifier& InOutputIdentifier,
 	const TArray<UObject*>& InOriginalObjects,
 	const TArray<TArray<FTransform>>& InOriginalTransforms,
+	const TArray<TArray<float>>& InOriginalCustomData,
+	const int32& InNumCustomDataFloats,
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutput>& InstancedOutputs,
 	TArray<TSoftObjectPtr<UObject>>& OutVariationsInstancedObjects,
 	TArray<TArray<FTransform>>& OutVariationsInstancedTransforms,
+	TArray<TArray<float>>& OutVariationsInstancedCustomData,
 	TArray<int32>& OutVariationOriginalObjectIdx,
 	TArray<int32>& OutVariationIndices)
 {
@@ -796,6 +852,10 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 		// Build this output object's split identifier
 		Identifier.SplitIdentifier = FString::FromInt(InstObjIdx);
 
+		// Ignore custom data that doesn't match the number of transforms
+		const bool bHasCustomData = InNumCustomDataFloats > 0 && InOriginalCustomData.IsValidIndex(InstObjIdx)
+			&& InOriginalCustomData[InstObjIdx].Num() == InOriginalTransforms[InstObjIdx].Num() * InNumCustomDataFloats;
+
 		// Do we have an instanced output object for this one?
 		FHoudiniInstancedOutput * FoundInstancedOutput = nullptr;
 		for (auto& Iter : InstancedOutputs)
@@ -825,6 +885,11 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			CurInstancedOutput.OriginalObject = OriginalObj;
 			CurInstancedOutput.OriginalObjectIndex = InstObjIdx;
 			CurInstancedOutput.OriginalTransforms = InOriginalTransforms[InstObjIdx];
+			if (bHasCustomData)
+			{
+				CurInstancedOutput.OriginalCustomData = InOriginalCustomData[InstObjIdx];
+				CurInstancedOutput.NumCustomDataFloats = InNumCustomDataFloats;
+			}
 
 			CurInstancedOutput.VariationObjects.Add(OriginalObj);
 			CurInstancedOutput.VariationTransformOffsets.Add(FTransform::Identity);
@@ -835,10 +900,11 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			// No variations, simply assign the object/transforms
 			OutVariationsInstancedObjects.Add(OriginalObj);
 			OutVariationsInstancedTransforms.Add(InOriginalTransforms[InstObjIdx]);
+			OutVariationsInstancedCustomData.Add(CurInstancedOutput.OriginalCustomData);
 			OutVariationOriginalObjectIdx.Add(InstObjIdx);
 			OutVariationIndices.Add(0);
 
-			InstancedOutputs.Add(Identifier, CurInstancedOutput);
+			InstancedOutputs.Add(Identifier, MoveTemp(CurInstancedOutput));
 		}
 		else
 		{
@@ -852,6 +918,16 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			}
 
 			CurInstancedOutput.OriginalTransforms = InOriginalTransforms[InstObjIdx];
+			if (bHasCustomData)
+			{
+				CurInstancedOutput.OriginalCustomData = InOriginalCustomData[InstObjIdx];
+				CurInstancedOutput.NumCustomDataFloats = InNumCustomDataFloats;
+			}
+			else
+			{
+				CurInstancedOutput.OriginalCustomData.Empty();
+				CurInstancedOutput.NumCustomDataFloats = 0;
+			}
 
 			// Shouldnt be needed...
 			CurInstancedOutput.OriginalObjectIndex = InstObjIdx;
@@ -891,6 +967,11 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 			if (CurInstancedOutput.TransformVariationIndices.Num() != CurInstancedOutput.OriginalTransforms.Num())
 				UpdateVariationAssignements(CurInstancedOutput);
 
+			// Get the transforms and custom data assigned to each variation
+			TArray<TArray<FTransform>> AllProcessedTransforms;
+			TArray<TArray<float>> AllProcessedCustomData;
+			ProcessInstanceTransforms(CurInstancedOutput, AllProcessedTransforms, &AllProcessedCustomData);
+
 			// Assign variations and their transforms
 			for (int32 VarIdx = 0; VarIdx < CurInstancedOutput.VariationObjects.Num(); VarIdx++)
 			{
@@ -898,13 +979,15 @@ FHoudiniInstanceTranslator::UpdateInstanceVariationObjects(
 				if (!CurrentVariationObject || CurrentVariationObject->IsPendingKill())
 					continue;
 
-				// Get the transforms assigned to that variation
-				TArray<FTransform> ProcessedTransforms;
-				ProcessInstanceTransforms(CurInstancedOutput, VarIdx, ProcessedTransforms);
+				if (!AllProcessedTransforms.IsValidIndex(VarIdx))
+					continue;
+
+				TArray<FTransform>& ProcessedTransforms = AllProcessedTransforms[VarIdx];
 				if (ProcessedTransforms.Num() > 0)
 				{
 					OutVariationsInstancedObjects.Add(CurrentVariationObject);
-					OutVariationsInstancedTransforms.Add(ProcessedTransforms);
+					OutVariationsInstancedTransforms.Add(MoveTemp(ProcessedTransforms));
+					OutVariationsInstancedCustomData.Add(MoveTemp(AllProcessedCustomData[VarIdx]));
 					OutVariationOriginalObjectIdx.Add(InstObjIdx);
 					OutVariationIndices.Add(VarIdx);
 				}
@@ -936,54 +1019,96 @@ FHoudiniInstanceTranslator::UpdateVariationAssignements(FHoudiniInstancedOutput&
 
 void
 FHoudiniInstanceTranslator::ProcessInstanceTransforms(
-	FHoudiniInstancedOutput& InstancedOutput, const int32& VariationIdx, TArray<FTransform>& OutProcessedTransforms)
+	FHoudiniInstancedOutput& InstancedOutput,
+	TArray<TArray<FTransform>>& OutProcessedTransforms,
+	TArray<TArray<float>>* OutProcessedCustomData)
 {
-	if (!InstancedOutput.VariationObjects.IsValidIndex(VariationIdx))
-		return;
-
-	if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx))
-		return;
+	const int32 VariationCount = InstancedOutput.VariationObjects.Num();
+	OutProcessedTransforms.SetNum(VariationCount);
 
-	bool bHasVariations = InstancedOutput.VariationObjects.Num() > 1;
-	bool bHasTransformOffset = InstancedOutput.VariationTransformOffsets.IsValidIndex(VariationIdx)
-		? !InstancedOutput.VariationTransformOffsets[VariationIdx].Equals(FTransform::Identity)
-		: false;
+	const TArray<FTransform>& OriginalTransforms = InstancedOutput.OriginalTransforms;
 
-	if (!bHasVariations && !bHasTransformOffset)
+	// Only split the custom data if we have the expected number of values
+	const TArray<float>& OriginalCustomData = InstancedOutput.OriginalCustomData;
+	const int32 NumCustomDataFloats = InstancedOutput.NumCustomDataFloats;
+	const bool bProcessCustomData = OutProcessedCustomData && NumCustomDataFloats > 0
+		&& OriginalCustomData.Num() == OriginalTransforms.Num() * NumCustomDataFloats;
+	if (OutProcessedCustomData)
 	{
-		// We dont have variations or transform offset, so we can reuse the original transforms as is
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
-		return;
+		OutProcessedCustomData->Empty();
+		OutProcessedCustomData->SetNum(VariationCount);
 	}
 
-	if (bHasVariations)
+	if (VariationCount <= 0)
+		return;
+
+	if (VariationCount == 1)
 	{
-		// We simply need to extract the transforms for this variation		
-		for (int32 TransformIndex = 0; TransformIndex < InstancedOutput.TransformVariationIndices.Num(); TransformIndex++)
+		// We dont have variations, so we can reuse the original transforms as is
+		OutProcessedTransforms[0] = OriginalTransforms;
+		if (bProcessCustomData)
+			(*OutProcessedCustomData)[0] = OriginalCustomData;
+	}
+	else
+	{
+		// Count the transforms assigned to each variation, then scatter them to their variation in a single pass
+		const TArray<int32>& VariationIndices = InstancedOutput.TransformVariationIndices;
+		const int32 TransformCount = FMath::Min(VariationIndices.Num(), OriginalTransforms.Num());
+
+		TArray<int32> VariationCounts;
+		VariationCounts.Init(0, VariationCount);
+		for (int32 TransformIndex = 0; TransformIndex < TransformCount; TransformIndex++)
 		{
-			if (InstancedOutput.TransformVariationIndices[TransformIndex] != VariationIdx)
+			if (VariationCounts.IsValidIndex(VariationIndices[TransformIndex]))
+				VariationCounts[VariationIndices[TransformIndex]]++;
+		}
+
+		for (int32 VarIdx = 0; VarIdx < VariationCount; VarIdx++)
+		{
+			OutProcessedTransforms[VarIdx].SetNumUninitialized(VariationCounts[VarIdx]);
+			if (bProcessCustomData)
+				(*OutProcessedCustomData)[VarIdx].SetNumUninitialized(VariationCounts[VarIdx] * NumCustomDataFloats);
+		}
+
+		TArray<int32> VariationCursors;
+		VariationCursors.Init(0, VariationCount);
+		for (int32 TransformIndex = 0; TransformIndex < TransformCount; TransformIndex++)
+		{
+			const int32& VarIdx = VariationIndices[TransformIndex];
+			if (!VariationCounts.IsValidIndex(VarIdx))
 				continue;
 
-			OutProcessedTransforms.Add(InstancedOutput.OriginalTransforms[TransformIndex]);
+			const int32 InstanceIndex = VariationCursors[VarIdx]++;
+			OutProcessedTransforms[VarIdx][InstanceIndex] = OriginalTransforms[TransformIndex];
+			if (bProcessCustomData)
+			{
+				FMemory::Memcpy(
+					(*OutProcessedCustomData)[VarIdx].GetData() + InstanceIndex * NumCustomDataFloats,
+					OriginalCustomData.GetData() + TransformIndex * NumCustomDataFloats,
+					NumCustomDataFloats * sizeof(float));
+			}
 		}
 	}
-	else
-	{
-		// No variations, we can reuse the original transforms
-		OutProcessedTransforms = InstancedOutput.OriginalTransforms;
-	}
 
-	if (bHasTransformOffset)
+	// Apply the transform offsets
+	for (int32 VarIdx = 0; VarIdx < VariationCount; VarIdx++)
 	{
+		if (!InstancedOutput.VariationTransformOffsets.IsValidIndex(VarIdx))
+			continue;
+
+		const FTransform& TransformOffset = InstancedOutput.VariationTransformOffsets[VarIdx];
+		if (TransformOffset.Equals(FTransform::Identity))
+			continue;
+
 		// Get the transform offset for this variation
-		FVector PositionOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetLocation();
-		FQuat RotationOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetRotation();
-		FVector ScaleOffset = InstancedOutput.VariationTransformOffsets[VariationIdx].GetScale3D();
+		const FVector PositionOffset = TransformOffset.GetLocation();
+		const FQuat RotationOffset = TransformOffset.GetRotation();
+		const FVector ScaleOffset = TransformOffset.GetScale3D();
 
-		FTransform CurrentTransform = FTransform::Identity;
-		for (int32 TransformIndex = 0; TransformIndex < OutProcessedTransforms.Num(); TransformIndex++)
+		TArray<FTransform>& ProcessedTransforms = OutProcessedTransforms[VarIdx];
+		ParallelFor(ProcessedTransforms.Num(), [&](int32 TransformIndex)
 		{
-			CurrentTransform = OutProcessedTransforms[TransformIndex];
+			FTransform CurrentTransform = ProcessedTransforms[TransformIndex];
 
 			// Compute new rotation and scale.
 			FVector Position = CurrentTransform.GetLocation() + PositionOffset;
@@ -1002,13 +1127,11 @@ FHoudiniInstanceTranslator::ProcessInstanceTransforms(
 			if (FMath::Abs(TransformScale3D.Z) < HAPI_UNREAL_SCALE_SMALL_VALUE)
 				TransformScale3D.Z = (TransformScale3D.Z > 0) ? HAPI_UNREAL_SCALE_SMALL_VALUE : -HAPI_UNREAL_SCALE_SMALL_VALUE;
 
-			CurrentTransform.SetLocation(Position);
-			CurrentTransform.SetRotation(TransformRotation);
-			CurrentTransform.SetScale3D(TransformScale3D);
+			CurrentTransform.SetComponents(TransformRotation, Position, TransformScale3D);
 
 			if (CurrentTransform.IsValid())
-				OutProcessedTransforms[TransformIndex] = CurrentTransform;
-		}
+				ProcessedTransforms[TransformIndex] = CurrentTransform;
+		});
 	}
 }
 
@@ -1026,19 +1149,14 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 
 	// Get transforms for each instance
 	TArray<HAPI_Transform> InstancerPartTransforms;
-	InstancerPartTransforms.SetNumZeroed(InHGPO.PartInfo.InstanceCount);
+	InstancerPartTransforms.SetNumUninitialized(InHGPO.PartInfo.InstanceCount);
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetInstancerPartTransforms(
 		FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartInfo.PartId,
 		HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, InHGPO.PartInfo.InstanceCount), false);
 
 	// Convert the transform to Unreal's coordinate system
 	TArray<FTransform> InstancerUnrealTransforms;
-	InstancerUnrealTransforms.SetNumUninitialized(InstancerPartTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, InstancerUnrealTransforms[InstanceIdx]);
-	}
+	FHoudiniEngineUtils::TranslateHapiTransforms(InstancerPartTransforms, InstancerUnrealTransforms);
 
 	// Get the part ids for parts being instanced
 	TArray<HAPI_PartId> InstancedPartIds;
@@ -1098,8 +1216,8 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 	// Split the instances using the split attribute's values
 	
 	// Move the output arrays to temp arrays
-	TArray<FHoudiniGeoPartObject> UnsplitInstancedHGPOs = OutInstancedHGPO;
-	TArray<TArray<FTransform>> UnsplitInstancedTransforms = OutInstancedTransforms;
+	TArray<FHoudiniGeoPartObject> UnsplitInstancedHGPOs = MoveTemp(OutInstancedHGPO);
+	TArray<TArray<FTransform>> UnsplitInstancedTransforms = MoveTemp(OutInstancedTransforms);
 
 	// Empty the output arrays
 	OutInstancedHGPO.Empty();
@@ -1146,7 +1264,7 @@ FHoudiniInstanceTranslator::GetPackedPrimitiveInstancerHGPOsAndTransforms(
 		{
 			OutSplitAttributeValue.Add(Iterator.Key);
 			OutInstancedHGPO.Add(UnsplitInstancedHGPOs[ObjIdx]);
-			OutInstancedTransforms.Add(Iterator.Value);
+			OutInstancedTransforms.Add(MoveTemp(Iterator.Value));
 		}
 	}
 
@@ -1161,6 +1279,8 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 	const FHoudiniGeoPartObject& InHGPO,
 	TArray<UObject*>& OutInstancedObjects,
 	TArray<TArray<FTransform>>& OutInstancedTransforms,
+	TArray<TArray<float>>& OutInstancedCustomData,
+	int32& OutNumCustomDataFloats,
 	FString& OutSplitAttributeName,
 	TArray<FString>& OutSplitAttributeValue,
 	TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes)
@@ -1242,9 +1362,12 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 
 	const bool bHasAnyPerSplitAttributes = bHasLevelPaths || bHasBakeActorNames || bHasBakeOutlinerFolders;
 
-	// Array used to store the split values per objects
-	// Will only be used if we have a split attribute
-	TArray<TArray<FString>> SplitAttributeValuesPerObject;
+	const int32 NumPoints = InstancerUnrealTransforms.Num();
+
+	// The unique objects to instance, and the index of each point's object in that array.
+	// Points whose object couldn't be loaded have an index of INDEX_NONE.
+	TArray<UObject*> InstancedObjects;
+	TArray<int32> PointObjectIndices;
 
 	if (AttribInfo.owner == HAPI_ATTROWNER_DETAIL)
 	{
@@ -1267,20 +1390,10 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 			return false;
 		}
 
-		// Attempt to load specified asset.
+		// Attempt to load specified asset, or to find a class that we can instantiate
+		// TODO: ensure we'll be able to create an actor from this class!
 		const FString & AssetName = DetailInstanceValues[0];
-		UObject * AttributeObject = StaticLoadObject(UObject::StaticClass(), nullptr, *AssetName, nullptr, LOAD_None, nullptr);
-
-		if (!AttributeObject)
-		{
-			// See if the ref is a class that we can instantiate
-			UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *AssetName);
-			if (FoundClass != nullptr)
-			{
-				// TODO: ensure we'll be able to create an actor from this class! 
-				AttributeObject = FoundClass;
-			}
-		}
+		UObject * AttributeObject = FHoudiniObjectPathCache::LoadObjectFromPath(AssetName, UObject::StaticClass(), true);
 
 		if (!AttributeObject && bDefaultObjectEnabled)
 		{
@@ -1300,201 +1413,300 @@ FHoudiniInstanceTranslator::GetAttributeInstancerObjectsAndTransforms(
 		// (with either the actual referenced object or the default placeholder object)
 		if (AttributeObject)
 		{
-			OutInstancedObjects.Add(AttributeObject);
-			OutInstancedTransforms.Add(InstancerUnrealTransforms);
-
-			if(bHasSplitAttribute)
-				SplitAttributeValuesPerObject.Add(AllSplitAttributeValues);
+			InstancedObjects.Add(AttributeObject);
+			PointObjectIndices.Init(0, NumPoints);
+		}
+		else
+		{
+			PointObjectIndices.Init(INDEX_NONE, NumPoints);
 		}
 	}
 	else
 	{
-		// Attribute is on points, so we may have different values for each of them
-		TArray<FString> PointInstanceValues;
-		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsStringFromInfo(
-			InHGPO.GeoId,
-			InHGPO.PartId,
+		// Attribute is on points, so we may have different values for each of them.
+		// Get the raw string handles, so each unique value is only converted and loaded once.
+		TArray<HAPI_StringHandle> PointInstanceHandles;
+		PointInstanceHandles.Init(-1, AttribInfo.count);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeStringData(
+			FHoudiniEngine::Get().GetSession(),
+			InHGPO.GeoId, InHGPO.PartId,
 			is_override_attr ? HAPI_UNREAL_ATTRIB_INSTANCE_OVERRIDE : HAPI_UNREAL_ATTRIB_INSTANCE,
-			AttribInfo,
-			PointInstanceValues))
-		{
-			// This should not happen - attribute exists, but there was an error retrieving it.
-			return false;
-		}
+			&AttribInfo, PointInstanceHandles.GetData(), 0, AttribInfo.count), false);
 
 		// The attribute is on points, so the number of points must match number of transforms.
-		if (!ensure(PointInstanceValues.Num() == InstancerUnrealTransforms.Num()))
+		if (!ensure(PointInstanceHandles.Num() == NumPoints))
 		{
 			// This should not happen, we have mismatch between number of instance values and transforms.
 			return false;
 		}
 
-		// If instance attribute exists on points, we need to get all the unique values.
-		// This will give us all the unique object we want to instance
-		TMap<FString, UObject *> ObjectsToInstance;
-		for (const auto& Iter : PointInstanceValues)
+		// Intern the handles first, then convert each unique handle to its path
+		TMap<HAPI_StringHandle, int32> HandleToUniqueIndex;
+		TArray<int32> PointUniqueIndices;
+		TArray<FString> UniquePaths;
+		PointUniqueIndices.SetNumUninitialized(NumPoints);
+		for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+		{
+			const HAPI_StringHandle& Handle = PointInstanceHandles[Idx];
+			int32* FoundUniqueIndex = HandleToUniqueIndex.Find(Handle);
+			if (!FoundUniqueIndex)
+			{
+				FString InstancePath;
+				FHoudiniEngineString::ToFString(Handle, InstancePath);
+				FoundUniqueIndex = &HandleToUniqueIndex.Add(Handle, UniquePaths.Add(InstancePath));
+			}
+
+			PointUniqueIndices[Idx] = *FoundUniqueIndex;
+		}
+
+		// Start loading all the packages that aren't in memory yet before resolving them one by one
+		FHoudiniObjectPathCache::PreloadObjectPaths(UniquePaths);
+
+		// Resolve the unique paths, different handles could still refer to the same value
+		TMap<FString, int32> PathToObjectIndex;
+		TArray<int32> UniqueObjectIndices;
+		UniqueObjectIndices.SetNumUninitialized(UniquePaths.Num());
+		for (int32 UniqueIdx = 0; UniqueIdx < UniquePaths.Num(); ++UniqueIdx)
 		{
-			if (!ObjectsToInstance.Contains(Iter))
+			const FString& InstancePath = UniquePaths[UniqueIdx];
+			int32 ObjectIndex = INDEX_NONE;
+			if (int32* FoundPathIndex = PathToObjectIndex.Find(InstancePath))
+			{
+				ObjectIndex = *FoundPathIndex;
+			}
+			else
 			{
-				// To avoid trying to load an object that fails multiple times,
-				// still add it to the array if null so we can still skip further attempts
-				UObject * AttributeObject = StaticLoadObject(
-					UObject::StaticClass(), nullptr, *Iter, nullptr, LOAD_None, nullptr);
+				// Load the object, or find a class that we can instantiate
+				// TODO: ensure we'll be able to create an actor from this class!
+				UObject * AttributeObject = FHoudiniObjectPathCache::LoadObjectFromPath(InstancePath, UObject::StaticClass(), true);
 
-				if (!AttributeObject)
+				if (!AttributeObject && bDefaultObjectEnabled)
 				{
-					// See if the ref is a class that we can instantiate
-					UClass * FoundClass = FindObject<UClass>(ANY_PACKAGE, *Iter);
-					if (FoundClass != nullptr)
+					HOUDINI_LOG_WARNING(
+						TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *InstancePath);
+
+					// If failed to load this object, add default reference mesh
+					UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
+					if (DefaultReferenceSM && !DefaultReferenceSM->IsPendingKill())
+					{
+						AttributeObject = DefaultReferenceSM;
+					}
+					else// Failed to load default reference mesh object
 					{
-						// TODO: ensure we'll be able to create an actor from this class!
-						AttributeObject = FoundClass;
+						HOUDINI_LOG_WARNING(TEXT("Failed to load default mesh."));
 					}
 				}
 
-				ObjectsToInstance.Add(Iter, AttributeObject);
+				if (AttributeObject)
+					ObjectIndex = InstancedObjects.Add(AttributeObject);
+
+				// Still add failed paths to the map so we can skip further attempts
+				PathToObjectIndex.Add(InstancePath, ObjectIndex);
 			}
+
+			UniqueObjectIndices[UniqueIdx] = ObjectIndex;
 		}
 
-		// Iterates through all the unique objects and get their corresponding transforms
-		bool Success = false;
-		for (auto Iter : ObjectsToInstance)
+		PointObjectIndices.SetNumUninitialized(NumPoints);
+		for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+			PointObjectIndices[Idx] = UniqueObjectIndices[PointUniqueIndices[Idx]];
+
+		if (InstancedObjects.Num() <= 0)
+			return false;
+	}
+
+	// Intern the split values as well
+	TArray<FString> SplitValues;
+	TArray<int32> PointSplitIndices;
+	if (bHasSplitAttribute)
+	{
+		OutSplitAttributeValue.Empty();
+		OutSplitAttributeName = SplitAttribName;
+
+		// We can't split the instances if we don't have a value per point
+		if (AllSplitAttributeValues.Num() != NumPoints)
+			return true;
+
+		TMap<FString, int32> SplitValueToIndex;
+		PointSplitIndices.SetNumUninitialized(NumPoints);
+		for (int32 Idx = 0; Idx < NumPoints; ++Idx)
 		{
-			bool bHiddenInGame = false;
-			// Check that we managed to load this object
-			UObject * AttributeObject = Iter.Value;
-			if (!AttributeObject && bDefaultObjectEnabled) 
-			{
-				HOUDINI_LOG_WARNING(
-					TEXT("Failed to load instanced object '%s', use default mesh (hidden in game)."), *(Iter.Key));
+			const FString& SplitValue = AllSplitAttributeValues[Idx];
+			int32* FoundSplitIndex = SplitValueToIndex.Find(SplitValue);
+			PointSplitIndices[Idx] = FoundSplitIndex ? *FoundSplitIndex : SplitValueToIndex.Add(SplitValue, SplitValues.Add(SplitValue));
+		}
+	}
 
-				// If failed to load this object, add default reference mesh
-				UStaticMesh * DefaultReferenceSM = FHoudiniEngine::Get().GetHoudiniDefaultReferenceMesh().Get();
-				if (DefaultReferenceSM && !DefaultReferenceSM->IsPendingKill())
-				{
-					AttributeObject = DefaultReferenceSM;
-					bHiddenInGame = true;
-				}
-				else// Failed to load default reference mesh object
-				{
-					HOUDINI_LOG_WARNING(TEXT("Failed to load default mesh."));
-					continue;
-				}
-			}
+	// Assign each point to a bucket per (object, split value), in order of first appearance.
+	// Without a split attribute, the buckets are simply the objects.
+	TArray<int32> BucketObjectIndices;
+	TArray<int32> BucketSplitIndices;
+	TArray<int32> PointBuckets;
+	PointBuckets.SetNumUninitialized(NumPoints);
+	if (!bHasSplitAttribute)
+	{
+		for (int32 ObjIdx = 0; ObjIdx < InstancedObjects.Num(); ObjIdx++)
+			BucketObjectIndices.Add(ObjIdx);
 
-			if (!AttributeObject)
+		PointBuckets = PointObjectIndices;
+	}
+	else
+	{
+		TMap<uint64, int32> KeyToBucket;
+		for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+		{
+			const int32& ObjectIndex = PointObjectIndices[Idx];
+			if (ObjectIndex == INDEX_NONE)
+			{
+				PointBuckets[Idx] = INDEX_NONE;
 				continue;
+			}
 
-			if (!bHasSplitAttribute)
+			const uint64 Key = ((uint64)ObjectIndex << 32) | (uint32)PointSplitIndices[Idx];
+			int32* FoundBucket = KeyToBucket.Find(Key);
+			if (!FoundBucket)
 			{
-				// No Split attribute:
-				// Extract the transform values that correspond to this object, and add them to the output arrays
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-				}
-
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				Success = true;
+				BucketObjectIndices.Add(ObjectIndex);
+				FoundBucket = &KeyToBucket.Add(Key, BucketSplitIndices.Add(PointSplitIndices[Idx]));
 			}
-			else
-			{
-				// We have a split attribute:
-				// Extract the transform values and split attribute values for this object,
-				// add them to the output arrays, and we will process the splits after
-				const FString & InstancePath = Iter.Key;
-				TArray<FTransform> ObjectTransforms;
-				TArray<FString> ObjectSplitValues;
-				for (int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx)
-				{
-					if (InstancePath.Equals(PointInstanceValues[Idx]))
-					{
-						ObjectTransforms.Add(InstancerUnrealTransforms[Idx]);
-						ObjectSplitValues.Add(AllSplitAttributeValues[Idx]);
-					}
-				}
+			PointBuckets[Idx] = *FoundBucket;
+		}
+	}
 
-				OutInstancedObjects.Add(AttributeObject);
-				OutInstancedTransforms.Add(ObjectTransforms);
-				SplitAttributeValuesPerObject.Add(ObjectSplitValues);
-				Success = true;
-			}
+	// Output the buckets grouped by object
+	const int32 NumBuckets = BucketObjectIndices.Num();
+	TArray<int32> BucketOrder;
+	BucketOrder.SetNumUninitialized(NumBuckets);
+	for (int32 BucketIdx = 0; BucketIdx < NumBuckets; BucketIdx++)
+		BucketOrder[BucketIdx] = BucketIdx;
+
+	BucketOrder.StableSort([&BucketObjectIndices](const int32& A, const int32& B)
+	{
+		return BucketObjectIndices[A] < BucketObjectIndices[B];
+	});
+
+	// Counting sort of the point indices by bucket
+	TArray<int32> BucketCounts;
+	BucketCounts.Init(0, NumBuckets);
+	for (const int32& Bucket : PointBuckets)
+	{
+		if (Bucket != INDEX_NONE)
+			BucketCounts[Bucket]++;
+	}
+
+	TArray<int32> BucketOffsets;
+	BucketOffsets.SetNumUninitialized(NumBuckets);
+	int32 NumSortedPoints = 0;
+	for (int32 Bucket : BucketOrder)
+	{
+		BucketOffsets[Bucket] = NumSortedPoints;
+		NumSortedPoints += BucketCounts[Bucket];
+	}
+
+	TArray<int32> SortedPoints;
+	SortedPoints.SetNumUninitialized(NumSortedPoints);
+	{
+		TArray<int32> BucketCursors = BucketOffsets;
+		for (int32 Idx = 0; Idx < NumPoints; ++Idx)
+		{
+			if (PointBuckets[Idx] != INDEX_NONE)
+				SortedPoints[BucketCursors[PointBuckets[Idx]]++] = Idx;
 		}
+	}
 
-		if (!Success) 
-			return false;
+	// Get the per-instance custom data
+	int32 NumCustomDataFloats = 0;
+	TArray<float> PointCustomData;
+	if (!GetPerInstanceCustomData(InHGPO.GeoId, InHGPO.PartId, NumPoints, NumCustomDataFloats, PointCustomData))
+		NumCustomDataFloats = 0;
+
+	// Split instancers store the point colors in the first 4 custom data floats,
+	// so that each subset of instances gets its own colors
+	if (IsSplitInstancer(InHGPO.GeoId, InHGPO.PartId) && HasPointInstanceColors(InHGPO))
+	{
+		TArray<FLinearColor> PointColors;
+		GetInstanceColors(InHGPO, PointColors);
+
+		const int32 NumAttributeFloats = NumCustomDataFloats;
+		NumCustomDataFloats = 4 + NumAttributeFloats;
+		TArray<float> ColorCustomData;
+		ColorCustomData.SetNumUninitialized(NumPoints * NumCustomDataFloats);
+		for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+		{
+			float* PointData = ColorCustomData.GetData() + PointIdx * NumCustomDataFloats;
+			const FLinearColor Color = PointColors.IsValidIndex(PointIdx) ? PointColors[PointIdx] : FLinearColor::White;
+			FMemory::Memcpy(PointData, &Color, sizeof(FLinearColor));
+			if (NumAttributeFloats > 0)
+				FMemory::Memcpy(PointData + 4, PointCustomData.GetData() + PointIdx * NumAttributeFloats, NumAttributeFloats * sizeof(float));
+		}
+		PointCustomData = MoveTemp(ColorCustomData);
 	}
 
-	// If we don't need to split the instances, we're done
-	if (!bHasSplitAttribute)
-		return true;
+	// Gather the transforms and custom data of each bucket
+	const int32 FirstOutputIdx = OutInstancedTransforms.Num();
+	OutInstancedTransforms.SetNum(FirstOutputIdx + NumBuckets);
+	OutInstancedCustomData.SetNum(FirstOutputIdx + NumBuckets);
+	OutNumCustomDataFloats = NumCustomDataFloats;
+	ParallelFor(NumBuckets, [&](int32 OrderIdx)
+	{
+		const int32 Bucket = BucketOrder[OrderIdx];
+		TArray<FTransform>& BucketTransforms = OutInstancedTransforms[FirstOutputIdx + OrderIdx];
+		BucketTransforms.SetNumUninitialized(BucketCounts[Bucket]);
+		for (int32 InstIdx = 0; InstIdx < BucketCounts[Bucket]; InstIdx++)
+			BucketTransforms[InstIdx] = InstancerUnrealTransforms[SortedPoints[BucketOffsets[Bucket] + InstIdx]];
 
-	// Split the instances one more time, this time using the split values
-	
-	// Move the output arrays to temp arrays
-	TArray<UObject*> UnsplitInstancedObjects = OutInstancedObjects;
-	TArray<TArray<FTransform>> UnsplitInstancedTransforms = OutInstancedTransforms;
+		if (NumCustomDataFloats <= 0)
+			return;
 
-	// Empty the output arrays
-	OutInstancedObjects.Empty();
-	OutInstancedTransforms.Empty();
+		TArray<float>& BucketCustomData = OutInstancedCustomData[FirstOutputIdx + OrderIdx];
+		BucketCustomData.SetNumUninitialized(BucketCounts[Bucket] * NumCustomDataFloats);
+		for (int32 InstIdx = 0; InstIdx < BucketCounts[Bucket]; InstIdx++)
+		{
+			FMemory::Memcpy(
+				BucketCustomData.GetData() + InstIdx * NumCustomDataFloats,
+				PointCustomData.GetData() + SortedPoints[BucketOffsets[Bucket] + InstIdx] * NumCustomDataFloats,
+				NumCustomDataFloats * sizeof(float));
+		}
+	});
 
-	// TODO: Output the split values as well!
-	OutSplitAttributeValue.Empty();
-	for (int32 ObjIdx = 0; ObjIdx < UnsplitInstancedObjects.Num(); ObjIdx++)
+	for (int32 Bucket : BucketOrder)
 	{
-		UObject* InstancedObject = UnsplitInstancedObjects[ObjIdx];
+		OutInstancedObjects.Add(InstancedObjects[BucketObjectIndices[Bucket]]);
 
-		// Map of split values to transform arrays
-		TMap<FString, TArray<FTransform>> SplitTransformMap;
+		if (!bHasSplitAttribute)
+			continue;
 
-		TArray<FTransform>& CurrentTransforms = UnsplitInstancedTransforms[ObjIdx];
-		TArray<FString>& CurrentSplits = SplitAttributeValuesPerObject[ObjIdx];
+		const FString& SplitAttrValue = SplitValues[BucketSplitIndices[Bucket]];
+		OutSplitAttributeValue.Add(SplitAttrValue);
 
-		int32 NumInstances = CurrentTransforms.Num();
-		if (CurrentSplits.Num() != NumInstances)
+		// Record attributes for any split value we have not yet seen
+		if (!bHasAnyPerSplitAttributes)
 			continue;
 
-		// Split the transforms using the split values
-		for (int32 InstIdx = 0; InstIdx < NumInstances; InstIdx++)
+		FHoudiniInstancedOutputPerSplitAttributes& PerSplitAttributes = OutPerSplitAttributes.FindOrAdd(SplitAttrValue);
+		for (int32 InstIdx = 0; InstIdx < BucketCounts[Bucket]; InstIdx++)
 		{
-			const FString& SplitAttrValue = CurrentSplits[InstIdx];
-			SplitTransformMap.FindOrAdd(SplitAttrValue).Add(CurrentTransforms[InstIdx]);
-			
-			// Record attributes for any split value we have not yet seen
-			if (bHasAnyPerSplitAttributes)
+			const int32 PointIdx = SortedPoints[BucketOffsets[Bucket] + InstIdx];
+			if (bHasLevelPaths && PerSplitAttributes.LevelPath.IsEmpty() && AllLevelPaths.IsValidIndex(PointIdx))
 			{
-				FHoudiniInstancedOutputPerSplitAttributes& PerSplitAttributes = OutPerSplitAttributes.FindOrAdd(SplitAttrValue);
-				if (bHasLevelPaths && PerSplitAttributes.LevelPath.IsEmpty() && AllLevelPaths.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.LevelPath = AllLevelPaths[InstIdx];
-				}
-				if (bHasBakeActorNames && PerSplitAttributes.BakeActorName.IsEmpty() && AllBakeActorNames.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeActorName = AllBakeActorNames[InstIdx];
-				}
-				if (bHasBakeOutlinerFolders && PerSplitAttributes.BakeOutlinerFolder.IsEmpty() && AllBakeOutlinerFolders.IsValidIndex(InstIdx))
-				{
-					PerSplitAttributes.BakeOutlinerFolder = AllBakeOutlinerFolders[InstIdx];
-				}
+				PerSplitAttributes.LevelPath = AllLevelPaths[PointIdx];
+			}
+			if (bHasBakeActorNames && PerSplitAttributes.BakeActorName.IsEmpty() && AllBakeActorNames.IsValidIndex(PointIdx))
+			{
+				PerSplitAttributes.BakeActorName = AllBakeActorNames[PointIdx];
+			}
+			if (bHasBakeOutlinerFolders && PerSplitAttributes.BakeOutlinerFolder.IsEmpty() && AllBakeOutlinerFolders.IsValidIndex(PointIdx))
+			{
+				PerSplitAttributes.BakeOutlinerFolder = AllBakeOutlinerFolders[PointIdx];
 			}
-		}
 
-		// Add the objects, transform, split values to the final arrays
-		for (auto& Iterator : SplitTransformMap)
-		{
-			OutSplitAttributeValue.Add(Iterator.Key);
-			OutInstancedObjects.Add(InstancedObject);
-			OutInstancedTransforms.Add(Iterator.Value);	
+			if ((!bHasLevelPaths || !PerSplitAttributes.LevelPath.IsEmpty())
+				&& (!bHasBakeActorNames || !PerSplitAttributes.BakeActorName.IsEmpty())
+				&& (!bHasBakeOutlinerFolders || !PerSplitAttributes.BakeOutlinerFolder.IsEmpty()))
+				break;
 		}
 	}
 
-	OutSplitAttributeName = SplitAttribName;
-
 	return true;
 }
 
@@ -1652,7 +1864,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	const bool& InIsFoliageInstancer,
 	const TArray<UMaterialInterface *>& InstancerMaterials,
 	const int32& InstancerObjectIdx,
-	const bool& bForceHISM)
+	const bool& bForceHISM,
+	const TArray<float>& InstancedObjectCustomData,
+	const int32& InNumCustomDataFloats)
 {
 	enum InstancerComponentType
 	{
@@ -1696,13 +1910,17 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 	if (!StaticMesh && !FoliageType)
 		HSM = Cast<UHoudiniStaticMesh>(InstancedObject);
 
+	// Split instancers that only differ by their colors can use a single ISM / HISM instead
+	bool bCollapseSplitInstancer = StaticMesh && InIsSplitMeshInstancer
+		&& IsCollapsibleSplitInstancer(InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId, AllPropertyAttributes, InstancerMaterials);
+
 	if (StaticMesh)
 	{
 		if (InstancedObjectTransforms.Num() == 1)
 			NewType = StaticMeshComponent;
 		else if (InIsFoliageInstancer)
 			NewType = Foliage;
-		else if (InIsSplitMeshInstancer)
+		else if (InIsSplitMeshInstancer && !bCollapseSplitInstancer)
 			NewType = MeshSplitInstancerComponent;
 		else if(StaticMesh->GetNumLODs() > 1 || bForceHISM)
 			NewType = HierarchicalInstancedStaticMeshComponent;
@@ -1747,16 +1965,57 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstanceComponent(
 		case InstancedStaticMeshComponent:
 		case HierarchicalInstancedStaticMeshComponent:
 		{
+			// Ignore custom data that doesn't match the number of instances
+			const int32 NumInstances = InstancedObjectTransforms.Num();
+			const int32 NumAttributeFloats =
+				(InNumCustomDataFloats > 0 && InstancedObjectCustomData.Num() == NumInstances * InNumCustomDataFloats) ? InNumCustomDataFloats : 0;
+
+			// Collapsed split instancers store their instance colors in the first 4 custom data floats,
+			// followed by the custom data from the attributes
+			int32 NumCustomDataFloats = NumAttributeFloats;
+			TArray<float> CollapsedCustomData;
+			const TArray<float>* CustomData = &InstancedObjectCustomData;
+			if (bCollapseSplitInstancer)
+			{
+				TArray<FLinearColor> InstanceColors;
+				int32 NumColorFloats = 0;
+				GetSplitInstanceColors(
+					InstancerGeoPartObject, NumInstances, InstancedObjectCustomData, NumAttributeFloats, InstanceColors, NumColorFloats);
+
+				// Attribute instancers' custom data already starts with the colors
+				if (NumColorFloats <= 0)
+				{
+					NumCustomDataFloats = 4 + NumAttributeFloats;
+					CollapsedCustomData.SetNumZeroed(NumInstances * NumCustomDataFloats);
+					for (int32 InstIdx = 0; InstIdx < NumInstances; InstIdx++)
+					{
+						float* InstanceCustomData = CollapsedCustomData.GetData() + InstIdx * NumCustomDataFloats;
+						if (InstanceColors.IsValidIndex(InstIdx))
+							FMemory::Memcpy(InstanceCustomData, &InstanceColors[InstIdx], sizeof(FLinearColor));
+
+						if (NumAttributeFloats > 0)
+							FMemory::Memcpy(InstanceCustomData + 4, InstancedObjectCustomData.GetData() + InstIdx * NumAttributeFloats, NumAttributeFloats * sizeof(float));
+					}
+					CustomData = &CollapsedCustomData;
+				}
+			}
+
 			// Create an Instanced Static Mesh Component
 			bSuccess = CreateOrUpdateInstancedStaticMeshComponent(
-				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterial, bForceHISM);
+				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent,
+				InstancerMaterial, bForceHISM, NumCustomDataFloats, *CustomData);
 		}
 		break;
 
 		case MeshSplitInstancerComponent:
 		{
+			TArray<FLinearColor> InstanceColors;
+			int32 NumColorFloats = 0;
+			GetSplitInstanceColors(
+				InstancerGeoPartObject, InstancedObjectTransforms.Num(), InstancedObjectCustomData, InNumCustomDataFloats, InstanceColors, NumColorFloats);
+
 			bSuccess = CreateOrUpdateMeshSplitInstancerComponent(
-				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterials);
+				StaticMesh, InstancedObjectTransforms, AllPropertyAttributes, InstancerGeoPartObject, ParentComponent, NewComponent, InstancerMaterials, InstanceColors);
 		}
 		break;
 
@@ -1823,7 +2082,9 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	USceneComponent* ParentComponent,
 	USceneComponent*& CreatedInstancedComponent,
 	UMaterialInterface * InstancerMaterial, /*=nullptr*/
-	const bool & bForceHISM)
+	const bool & bForceHISM,
+	const int32& InNumCustomDataFloats,
+	const TArray<float>& InCustomData)
 {
 	if (!InstancedStaticMesh)
 		return false;
@@ -1873,20 +2134,27 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	}
 
 	// Now add the instances themselves
-	// TODO: We should be calling  UHoudiniInstancedActorComponent::UpdateInstancerComponentInstances( ... )
-	InstancedStaticMeshComponent->ClearInstances();
-	InstancedStaticMeshComponent->PreAllocateInstancesMemory(InstancedObjectTransforms.Num());
-	for (const auto& Transform : InstancedObjectTransforms)
+	if (bCreatedNewComponent)
+	{
+		InstancedStaticMeshComponent->AddInstances(InstancedObjectTransforms, false);
+	}
+	else
 	{
-		InstancedStaticMeshComponent->AddInstance(Transform);
+		UpdateInstancedStaticMeshComponentInstances(InstancedStaticMeshComponent, InstancedObjectTransforms);
 	}
 
+	// Set the per-instance custom data before building the HISM tree, as the tree's instance data uses it
+	UpdateInstancedStaticMeshComponentCustomData(InstancedStaticMeshComponent, InNumCustomDataFloats, InCustomData);
+
+	// Rebuild the HISM tree once, now that all the instances have been updated
+	UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InstancedStaticMeshComponent);
+	if (HISMC)
+		HISMC->BuildTreeIfOutdated(false, false);
+
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	for (const auto& CurrentAttrib : AllPropertyAttributes)
-	{
+	if (AllPropertyAttributes.Num() > 0)
 		UpdateGenericPropertiesAttributes(InstancedStaticMeshComponent, AllPropertyAttributes, 0);
-	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
 	if(bCreatedNewComponent)
@@ -1899,6 +2167,123 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedStaticMeshComponent(
 	return true;
 }
 
+void
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentInstances(
+	UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+	const TArray<FTransform>& InstancedObjectTransforms)
+{
+	if (!InstancedStaticMeshComponent || InstancedStaticMeshComponent->IsPendingKill())
+		return;
+
+	const int32 NumCurrentInstances = InstancedStaticMeshComponent->GetInstanceCount();
+	const int32 NumNewInstances = InstancedObjectTransforms.Num();
+	const int32 NumCommonInstances = FMath::Min(NumCurrentInstances, NumNewInstances);
+
+	UHierarchicalInstancedStaticMeshComponent* HISMC = Cast<UHierarchicalInstancedStaticMeshComponent>(InstancedStaticMeshComponent);
+	if (NumNewInstances < NumCurrentInstances && !HISMC)
+	{
+		// ISMCs can only remove their instances one by one,
+		// so clear them and add the new ones in a single batch instead
+		InstancedStaticMeshComponent->ClearInstances();
+		InstancedStaticMeshComponent->AddInstances(InstancedObjectTransforms, false);
+		InstancedStaticMeshComponent->MarkRenderStateDirty();
+		return;
+	}
+
+	bool bHasChanged = false;
+
+	// Update the ranges of existing instances whose transforms have changed
+	int32 Idx = 0;
+	while (Idx < NumCommonInstances)
+	{
+		FTransform CurrentTransform;
+		InstancedStaticMeshComponent->GetInstanceTransform(Idx, CurrentTransform, false);
+		if (CurrentTransform.Equals(InstancedObjectTransforms[Idx]))
+		{
+			Idx++;
+			continue;
+		}
+
+		// Find the end of this range of changed instances
+		int32 RangeEnd = Idx + 1;
+		while (RangeEnd < NumCommonInstances)
+		{
+			InstancedStaticMeshComponent->GetInstanceTransform(RangeEnd, CurrentTransform, false);
+			if (CurrentTransform.Equals(InstancedObjectTransforms[RangeEnd]))
+				break;
+			RangeEnd++;
+		}
+
+		TArray<FTransform> RangeTransforms(InstancedObjectTransforms.GetData() + Idx, RangeEnd - Idx);
+		InstancedStaticMeshComponent->BatchUpdateInstancesTransforms(Idx, RangeTransforms, false, false, false);
+		bHasChanged = true;
+
+		Idx = RangeEnd;
+	}
+
+	if (NumNewInstances > NumCurrentInstances)
+	{
+		// Add the missing instances
+		TArray<FTransform> AddedTransforms(InstancedObjectTransforms.GetData() + NumCurrentInstances, NumNewInstances - NumCurrentInstances);
+		InstancedStaticMeshComponent->AddInstances(AddedTransforms, false);
+		bHasChanged = true;
+	}
+	else if (NumNewInstances < NumCurrentInstances)
+	{
+		// Remove the extra instances at the end in one batch, the other instances don't need to be reindexed
+		TArray<int32> RemovedInstances;
+		RemovedInstances.Reserve(NumCurrentInstances - NumNewInstances);
+		for (int32 RemoveIdx = NumCurrentInstances - 1; RemoveIdx >= NumNewInstances; RemoveIdx--)
+			RemovedInstances.Add(RemoveIdx);
+
+		HISMC->RemoveInstances(RemovedInstances);
+		bHasChanged = true;
+	}
+
+	if (bHasChanged)
+		InstancedStaticMeshComponent->MarkRenderStateDirty();
+}
+
+void
+FHoudiniInstanceTranslator::UpdateInstancedStaticMeshComponentCustomData(
+	UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+	const int32& InNumCustomDataFloats,
+	const TArray<float>& InCustomData)
+{
+	if (!InstancedStaticMeshComponent || InstancedStaticMeshComponent->IsPendingKill())
+		return;
+
+	const int32 NumInstances = InstancedStaticMeshComponent->GetInstanceCount();
+	const int32 NumFloats = FMath::Max(InNumCustomDataFloats, 0);
+	const int32 NumValues = NumInstances * NumFloats;
+	const int32 NumCopiedValues = FMath::Min(NumValues, InCustomData.Num());
+
+	// Copy all the values at once, missing values are zeroed
+	TArray<float>& PerInstanceCustomData = InstancedStaticMeshComponent->PerInstanceSMCustomData;
+	const bool bHasChanged = InstancedStaticMeshComponent->NumCustomDataFloats != NumFloats
+		|| PerInstanceCustomData.Num() != NumValues
+		|| (NumCopiedValues > 0 && FMemory::Memcmp(PerInstanceCustomData.GetData(), InCustomData.GetData(), NumCopiedValues * sizeof(float)) != 0)
+		|| (NumValues > NumCopiedValues);
+
+	if (!bHasChanged)
+		return;
+
+	InstancedStaticMeshComponent->NumCustomDataFloats = NumFloats;
+	PerInstanceCustomData.SetNumUninitialized(NumValues);
+	if (NumCopiedValues > 0)
+		FMemory::Memcpy(PerInstanceCustomData.GetData(), InCustomData.GetData(), NumCopiedValues * sizeof(float));
+	if (NumValues > NumCopiedValues)
+		FMemory::Memzero(PerInstanceCustomData.GetData() + NumCopiedValues, (NumValues - NumCopiedValues) * sizeof(float));
+
+	// Components that aren't registered don't have any render data yet
+	if (!InstancedStaticMeshComponent->IsRegistered())
+		return;
+
+	// Rebuild the instances' render data once for all the values
+	InstancedStaticMeshComponent->InstanceUpdateCmdBuffer.Edit();
+	InstancedStaticMeshComponent->MarkRenderStateDirty();
+}
+
 bool
 FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	UObject* InstancedObject,
@@ -1938,8 +2323,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	bool bInstancedObjectHasChanged = (InstancedObject != InstancedActorComponent->GetInstancedObject());
 	if (bInstancedObjectHasChanged)
 	{
-		// All actors will need to be respawned, invalidate all of them
-		InstancedActorComponent->ClearAllInstances();
+		// All actors will need to be replaced, the previous object's pool is trimmed after the update
+		InstancedActorComponent->ReleaseAllInstancesToPool();
 
 		// Update the HIAC's instanced asset
 		InstancedActorComponent->SetInstancedObject(InstancedObject);
@@ -1950,7 +2335,10 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 	if (!SpawnLevel)
 		return false;
 
-	// Set the number of needed instances
+	// Previous pending spawns are replaced by this update
+	InstancedActorComponent->ClearPendingSpawns();
+
+	// Set the number of needed instances, extra actors are sent to the pool
 	InstancedActorComponent->SetNumberOfInstances(InstancedObjectTransforms.Num());
 	for (int32 Idx = 0; Idx < InstancedObjectTransforms.Num(); Idx++)
 	{
@@ -1958,11 +2346,18 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 		const FTransform& CurTransform = InstancedObjectTransforms[Idx];
 
 		// Get the current instance
-		// If null, we need to create a new one, else we can reuse the actor
+		// If null, try to reuse a pooled actor, else we'll need to spawn a new one
 		AActor* CurInstance = InstancedActorComponent->GetInstancedActorAt(Idx);
 		if (!CurInstance || CurInstance->IsPendingKill())
 		{
-			CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InstancedActorComponent);
+			CurInstance = InstancedActorComponent->AcquirePooledActor();
+			if (!CurInstance)
+			{
+				InstancedActorComponent->GetPendingSpawnIndicesForWrite().Add(Idx);
+				InstancedActorComponent->GetPendingSpawnTransformsForWrite().Add(CurTransform);
+				continue;
+			}
+
 			InstancedActorComponent->SetInstanceAt(Idx, CurTransform, CurInstance);
 		}
 		else
@@ -1970,10 +2365,42 @@ FHoudiniInstanceTranslator::CreateOrUpdateInstancedActorComponent(
 			// We can simply update the actor's transform
 			InstancedActorComponent->SetInstanceTransformAt(Idx, CurTransform);
 		}
+	}
+
+	// Destroy the pooled actors of the objects we don't instance anymore
+	InstancedActorComponent->TrimActorPools();
 
-		// Update the generic properties for that instance if any
-		// TODO: Handle instance variations w/ Idx
-		UpdateGenericPropertiesAttributes(CurInstance, AllPropertyAttributes, Idx);
+	// Update the generic properties of all the instances at once
+	// The pending spawns get theirs when they are spawned
+	// TODO: Handle instance variations w/ Idx
+	if (AllPropertyAttributes.Num() > 0)
+	{
+		UpdateGenericPropertiesAttributesOnInstances(
+			TArray<UObject*>(InstancedActorComponent->GetInstancedActors()), AllPropertyAttributes);
+	}
+
+	// Spawn the missing actors within the time budget, the remaining ones are spawned on the next ticks
+	if (InstancedActorComponent->HasPendingSpawns())
+	{
+		InstancedActorComponent->GetPendingSpawnPropertyAttributesForWrite() = AllPropertyAttributes;
+		if (!SpawnPendingInstancedActors(InstancedActorComponent, HAPI_UNREAL_INSTANCED_ACTOR_SPAWN_BUDGET)
+			&& !InstancedActorComponent->PendingSpawnTickerHandle.IsValid())
+		{
+			TWeakObjectPtr<UHoudiniInstancedActorComponent> WeakIAC(InstancedActorComponent);
+			InstancedActorComponent->PendingSpawnTickerHandle = FTicker::GetCoreTicker().AddTicker(
+				FTickerDelegate::CreateLambda([WeakIAC](float DeltaTime)
+			{
+				UHoudiniInstancedActorComponent* IAC = WeakIAC.Get();
+				if (!IAC || IAC->IsPendingKill())
+					return false;
+
+				if (!SpawnPendingInstancedActors(IAC, HAPI_UNREAL_INSTANCED_ACTOR_SPAWN_BUDGET))
+					return true;
+
+				IAC->PendingSpawnTickerHandle.Reset();
+				return false;
+			}));
+		}
 	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
@@ -1994,7 +2421,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 	const FHoudiniGeoPartObject& InstancerGeoPartObject,
 	USceneComponent* ParentComponent,
 	USceneComponent*& CreatedInstancedComponent,
-	const TArray<UMaterialInterface *>& InInstancerMaterials)
+	const TArray<UMaterialInterface *>& InInstancerMaterials,
+	const TArray<FLinearColor>& InInstanceColors)
 {
 	if (!InstancedStaticMesh)
 		return false;
@@ -2026,105 +2454,28 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 	MeshSplitComponent->SetStaticMesh(InstancedStaticMesh);
 	MeshSplitComponent->SetOverrideMaterials(InInstancerMaterials);
 
-	// Now add the instances
-	MeshSplitComponent->SetInstanceTransforms(InstancedObjectTransforms);
-
-	// Check for instance colors
-	TArray<FLinearColor> InstanceColorOverrides;
-	bool ColorOverrideAttributeFound = false;
-
-	// Look for the unreal_instance_color attribute on points	
-	HAPI_AttributeInfo AttributeInfo;
-	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
-	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeInfo(
-		FHoudiniEngine::Get().GetSession(), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId,
-		HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, HAPI_AttributeOwner::HAPI_ATTROWNER_POINT, &AttributeInfo))
-	{
-		ColorOverrideAttributeFound = AttributeInfo.exists;
-	}
-	
-	// Look for the unreal_instance_color attribute on prims? (why? original code)
-	if (!ColorOverrideAttributeFound)
-	{
-		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeInfo(
-			FHoudiniEngine::Get().GetSession(), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId,
-			HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, HAPI_AttributeOwner::HAPI_ATTROWNER_PRIM, &AttributeInfo))
-		{
-			ColorOverrideAttributeFound = AttributeInfo.exists;
-		}
-	}
-
-	if (ColorOverrideAttributeFound)
-	{
-		if (AttributeInfo.tupleSize == 4)
-		{
-			// Allocate sufficient buffer for data.
-			InstanceColorOverrides.SetNumZeroed(AttributeInfo.count);
-
-			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId,
-				HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, &AttributeInfo, -1, (float*)InstanceColorOverrides.GetData(), 0, AttributeInfo.count))
-			{
-				InstanceColorOverrides.Empty();
-			}
-		}
-		else if (AttributeInfo.tupleSize == 3)
-		{
-			// Allocate sufficient buffer for data.
-			TArray<float> FloatValues;			
-			FloatValues.SetNumZeroed(AttributeInfo.count * AttributeInfo.tupleSize);
-			if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeFloatData(
-				FHoudiniEngine::Get().GetSession(), InstancerGeoPartObject.GeoId, InstancerGeoPartObject.PartId,
-				HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, &AttributeInfo, -1, (float*)FloatValues.GetData(), 0, AttributeInfo.count))
-			{
-
-				// Allocate sufficient buffer for data.
-				InstanceColorOverrides.SetNumZeroed(AttributeInfo.count);
-
-				// Convert float to FLinearColors
-				for (int32 ColorIdx = 0; ColorIdx < InstanceColorOverrides.Num(); ColorIdx++)
-				{
-					InstanceColorOverrides[ColorIdx].R = FloatValues[ColorIdx * AttributeInfo.tupleSize + 0];
-					InstanceColorOverrides[ColorIdx].G = FloatValues[ColorIdx * AttributeInfo.tupleSize + 1];
-					InstanceColorOverrides[ColorIdx].B = FloatValues[ColorIdx * AttributeInfo.tupleSize + 2];
-					InstanceColorOverrides[ColorIdx].A = 1.0;
-				}
-				FloatValues.Empty();
-			}
-		}
-		else
-		{
-			HOUDINI_LOG_WARNING(TEXT(HAPI_UNREAL_ATTRIB_INSTANCE_COLOR " must be a float[4] or float[3] prim/point attribute"));
-		}
-	}
+	// Now add the instances and their colors in a single batch
+	TArray<int32> ColorChangedInstances;
+	MeshSplitComponent->SetInstances(InstancedObjectTransforms, InInstanceColors, &ColorChangedInstances);
 
 	// if we have vertex color overrides, apply them now
+	// Only the instances whose color or mesh has changed need their vertex colors to be updated
 #if WITH_EDITOR
-	if (InstanceColorOverrides.Num() > 0)
+	if (ColorChangedInstances.Num() > 0)
 	{
-		// Convert the color attribute to FColor
-		TArray<FColor> InstanceColors;
-		InstanceColors.SetNumUninitialized(InstanceColorOverrides.Num());
-		for (int32 ix = 0; ix < InstanceColors.Num(); ++ix)
-		{
-			InstanceColors[ix] = InstanceColorOverrides[ix].GetClamped().ToFColor(false);
-		}
-
-		// Apply them to the instances
 		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
-		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
+		for (const int32& InstIndex : ColorChangedInstances)
 		{
-			UStaticMeshComponent* CurSMC = Instances[InstIndex];
-			if (!CurSMC || CurSMC->IsPendingKill())
+			if (!Instances.IsValidIndex(InstIndex) || !InInstanceColors.IsValidIndex(InstIndex))
 				continue;
 
-			if (!InstanceColors.IsValidIndex(InstIndex))
+			UStaticMeshComponent* CurSMC = Instances[InstIndex];
+			if (!CurSMC || CurSMC->IsPendingKill())
 				continue;
 
-			MeshPaintHelpers::FillStaticMeshVertexColors(CurSMC, -1, InstanceColors[InstIndex], FColor::White);
-
-			//CurSMC->UnregisterComponent();
-			//CurSMC->ReregisterComponent();
+			// Convert the color attribute to FColor
+			const FColor InstanceColor = InInstanceColors[InstIndex].GetClamped().ToFColor(false);
+			MeshPaintHelpers::FillStaticMeshVertexColors(CurSMC, -1, InstanceColor, FColor::White);
 
 			{
 				// We're only changing instanced vertices on this specific mesh component, so we
@@ -2144,23 +2495,10 @@ FHoudiniInstanceTranslator::CreateOrUpdateMeshSplitInstancerComponent(
 
 	// Apply generic attributes if we have any
 	// TODO: Handle variations w/ index
-	// TODO: Optimize
-	// Loop on attributes first, then components,
-	// if failing to find the attrib on a component, skip the rest
 	if (AllPropertyAttributes.Num() > 0)
 	{
-		TArray<class UStaticMeshComponent*>& Instances = MeshSplitComponent->GetInstancesForWrite();
-		for (int32 InstIndex = 0; InstIndex < Instances.Num(); InstIndex++)
-		{
-			UStaticMeshComponent* CurSMC = Instances[InstIndex];
-			if (!CurSMC || CurSMC->IsPendingKill())
-				continue;
-
-			for (const auto& CurrentAttrib : AllPropertyAttributes)
-			{
-				UpdateGenericPropertiesAttributes(CurSMC, AllPropertyAttributes, InstIndex);
-			}
-		}
+		UpdateGenericPropertiesAttributesOnInstances(
+			TArray<UObject*>(MeshSplitComponent->GetInstancesForWrite()), AllPropertyAttributes);
 	}
 
 	// Assign the new ISMC / HISMC to the output component if we created a new one
@@ -2376,23 +2714,20 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 		bCreatedNew = true;
 	}
 
-	if (!bCreatedNew && CreatedInstancedComponent)
-	{
-		// TODO: Shouldnt be needed anymore
-		// Clean up the instances previously generated for that component
-		InstancedFoliageActor->DeleteInstancesForComponent(ParentComponent, FoliageType);
-	}
-
- 	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
+	// Get the FoliageMeshInfo for this Foliage type so we can add the instance to it
 	FFoliageInfo* FoliageInfo = InstancedFoliageActor->FindOrAddMesh(FoliageType);
 	if (!FoliageInfo)
 		return false;
 
+	// Compute the foliage instances
 	FTransform HoudiniAssetTransform = ParentComponent->GetComponentTransform();
-	FFoliageInstance FoliageInstance;
-	int32 CurrentInstanceCount = 0;
-	for (auto CurrentTransform : InstancedObjectTransforms)
+	TArray<FFoliageInstance> FoliageInstances;
+	FoliageInstances.SetNum(InstancedObjectTransforms.Num());
+	ParallelFor(InstancedObjectTransforms.Num(), [&](int32 Idx)
 	{
+		const FTransform& CurrentTransform = InstancedObjectTransforms[Idx];
+		FFoliageInstance& FoliageInstance = FoliageInstances[Idx];
+
 		// Use our parent component for the base component of the instances,
 		// this will allow us to clean the instances by component
 		FoliageInstance.BaseComponent = ParentComponent;
@@ -2412,11 +2747,88 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 			FoliageInstance.Rotation = HoudiniAssetTransform.TransformRotation(CurrentTransform.GetRotation()).Rotator();
 			FoliageInstance.DrawScale3D = CurrentTransform.GetScale3D() * HoudiniAssetTransform.GetScale3D();
 		}
+	});
 
-		FoliageInfo->AddInstance(InstancedFoliageActor, FoliageType, FoliageInstance);
-		CurrentInstanceCount++;
+	// Several instancers of the same cook can use the same foliage type, and their instances
+	// all share our parent component as base. Only diff the instances for the first of them,
+	// the following ones simply add their instances.
+	static TSet<TPair<const USceneComponent*, const UFoliageType*>> DiffedFoliageTypes;
+	static uint64 DiffedFoliageTypesFrame = 0;
+	if (DiffedFoliageTypesFrame != GFrameCounter)
+	{
+		DiffedFoliageTypes.Reset();
+		DiffedFoliageTypesFrame = GFrameCounter;
 	}
 
+	bool bAlreadyDiffed = false;
+	DiffedFoliageTypes.Add(TPair<const USceneComponent*, const UFoliageType*>(ParentComponent, FoliageType), &bAlreadyDiffed);
+
+	// Diff the new instances against the ones previously generated for that component,
+	// so only the instances that have changed are removed or added
+	TArray<const FFoliageInstance*> InstancesToAdd;
+	InstancesToAdd.Reserve(FoliageInstances.Num());
+	if (!bCreatedNew && !bAlreadyDiffed)
+	{
+		// Hash the existing instances by location
+		auto GetLocationHash = [](const FFoliageInstance& InInstance)
+		{
+			FIntVector Key(
+				FMath::RoundToInt(InInstance.Location.X),
+				FMath::RoundToInt(InInstance.Location.Y),
+				FMath::RoundToInt(InInstance.Location.Z));
+			return GetTypeHash(Key);
+		};
+
+		TMultiMap<uint32, int32> ExistingInstances;
+		const TSet<int32>* ComponentInstances = FoliageInfo->ComponentHash.Find(
+			InstancedFoliageActor->InstanceBaseCache.GetInstanceBaseId(ParentComponent));
+		if (ComponentInstances)
+		{
+			for (int32 InstanceIdx : *ComponentInstances)
+			{
+				if (FoliageInfo->Instances.IsValidIndex(InstanceIdx))
+					ExistingInstances.Add(GetLocationHash(FoliageInfo->Instances[InstanceIdx]), InstanceIdx);
+			}
+		}
+
+		for (const FFoliageInstance& NewInstance : FoliageInstances)
+		{
+			// Look for an identical existing instance that we can keep
+			uint32 Hash = GetLocationHash(NewInstance);
+			int32 MatchingIdx = INDEX_NONE;
+			for (auto It = ExistingInstances.CreateKeyIterator(Hash); It; ++It)
+			{
+				const FFoliageInstance& ExistingInstance = FoliageInfo->Instances[It.Value()];
+				if (ExistingInstance.Location.Equals(NewInstance.Location)
+					&& ExistingInstance.Rotation.Equals(NewInstance.Rotation)
+					&& ExistingInstance.DrawScale3D.Equals(NewInstance.DrawScale3D))
+				{
+					MatchingIdx = It.Value();
+					It.RemoveCurrent();
+					break;
+				}
+			}
+
+			if (MatchingIdx == INDEX_NONE)
+				InstancesToAdd.Add(&NewInstance);
+		}
+
+		// The existing instances that weren't matched need to be removed
+		TArray<int32> InstancesToRemove;
+		ExistingInstances.GenerateValueArray(InstancesToRemove);
+		if (InstancesToRemove.Num() > 0)
+			FoliageInfo->RemoveInstances(InstancedFoliageActor, InstancesToRemove, false);
+	}
+	else
+	{
+		for (const FFoliageInstance& NewInstance : FoliageInstances)
+			InstancesToAdd.Add(&NewInstance);
+	}
+
+	// Add all the new instances at once
+	if (InstancesToAdd.Num() > 0)
+		FoliageInfo->AddInstances(InstancedFoliageActor, FoliageType, InstancesToAdd);
+
 	UHierarchicalInstancedStaticMeshComponent* FoliageHISMC = FoliageInfo->GetComponent();
 	// TODO: This was due to a bug in UE4.22-20, check if still needed! 
 	if (FoliageHISMC)
@@ -2446,7 +2858,8 @@ FHoudiniInstanceTranslator::CreateOrUpdateFoliageInstances(
 	UpdateGenericPropertiesAttributes(InstancedStaticMesh, AllPropertyAttributes, 0);
 	UpdateGenericPropertiesAttributes(FoliageType, AllPropertyAttributes, 0);
 
-	if (bCreatedNew && FoliageHISMC)
+	// Existing foliage types keep their component, which might not have been ours yet
+	if (FoliageHISMC)
 		CreatedInstancedComponent = FoliageHISMC;
 
 	// TODO:
@@ -2465,11 +2878,9 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	if (PointCount <= 0)
 		return false;
 
+	// No need to initialize the transforms, HAPI fills all of them
 	TArray<HAPI_Transform> InstanceTransforms;
-	InstanceTransforms.SetNum(PointCount);
-	for (int32 Idx = 0; Idx < InstanceTransforms.Num(); Idx++)
-		FHoudiniApi::Transform_Init(&(InstanceTransforms[Idx]));
-
+	InstanceTransforms.SetNumUninitialized(PointCount);
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetInstanceTransformsOnPart(
 		FHoudiniEngine::Get().GetSession(),
 		InHGPO.GeoId, InHGPO.PartId, HAPI_SRT,
@@ -2482,12 +2893,7 @@ FHoudiniInstanceTranslator::HapiGetInstanceTransforms(
 	}
 
 	// Convert the transform to Unreal's coordinate system
-	OutInstancerUnrealTransforms.SetNumZeroed(InstanceTransforms.Num());
-	for (int32 InstanceIdx = 0; InstanceIdx < InstanceTransforms.Num(); InstanceIdx++)
-	{
-		const auto& InstanceTransform = InstanceTransforms[InstanceIdx];
-		FHoudiniEngineUtils::TranslateHapiTransform(InstanceTransform, OutInstancerUnrealTransforms[InstanceIdx]);
-	}
+	FHoudiniEngineUtils::TranslateHapiTransforms(InstanceTransforms, OutInstancerUnrealTransforms);
 
 	return true;
 }
@@ -2535,6 +2941,44 @@ FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributes(
 	return (NumSuccess > 0);
 }
 
+int32
+FHoudiniInstanceTranslator::UpdateGenericPropertiesAttributesOnInstances(
+	const TArray<UObject*>& InInstances, const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes)
+{
+	TArray<bool> ModifiedInstances;
+	ModifiedInstances.SetNumZeroed(InInstances.Num());
+
+	// Apply one attribute at a time on all the instances, the property is only resolved once per class
+	for (const auto& CurrentPropAttribute : InAllPropertyAttributes)
+	{
+		int32 NumSuccess = 0;
+		for (int32 InstIdx = 0; InstIdx < InInstances.Num(); InstIdx++)
+		{
+			UObject* CurInstance = InInstances[InstIdx];
+			if (!CurInstance || CurInstance->IsPendingKill())
+				continue;
+
+			if (!FHoudiniGenericAttribute::UpdatePropertyAttributeOnObject(CurInstance, CurrentPropAttribute, InstIdx))
+				continue;
+
+			ModifiedInstances[InstIdx] = true;
+			NumSuccess++;
+		}
+
+		if (NumSuccess > 0)
+			HOUDINI_LOG_MESSAGE(TEXT("Modified UProperty %s on %d instances"), *CurrentPropAttribute.AttributeName, NumSuccess);
+	}
+
+	int32 NumModifiedInstances = 0;
+	for (const bool& bModified : ModifiedInstances)
+	{
+		if (bModified)
+			NumModifiedInstances++;
+	}
+
+	return NumModifiedInstances;
+}
+
 bool
 FHoudiniInstanceTranslator::RemoveAndDestroyComponent(UObject* InComponent)
 {
@@ -2622,8 +3066,7 @@ FHoudiniInstanceTranslator::GetInstancerMaterials(
 		if (!FoundMaterial)
 		{
 			// See if we can find a material interface that matches the attribute
-			CurrentMaterialInterface = Cast<UMaterialInterface>(
-				StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *CurrentMatString, nullptr, LOAD_NoWarn, nullptr));
+			CurrentMaterialInterface = FHoudiniObjectPathCache::LoadObjectFromPath<UMaterialInterface>(CurrentMatString, LOAD_NoWarn);
 
 			// Check validity
 			if (!CurrentMaterialInterface || CurrentMaterialInterface->IsPendingKill())
@@ -2744,6 +3187,251 @@ FHoudiniInstanceTranslator::IsSplitInstancer(const int32& InGeoId, const int32&
 	return (IntData[0] != 0);
 }
 
+bool
+FHoudiniInstanceTranslator::IsCollapsibleSplitInstancer(
+	const int32& InGeoId,
+	const int32& InPartId,
+	const TArray<FHoudiniGenericAttribute>& AllPropertyAttributes,
+	const TArray<UMaterialInterface*>& InInstancerMaterials)
+{
+	// Property attributes are applied per component, so they require the split components
+	if (AllPropertyAttributes.Num() > 0)
+		return false;
+
+	// All instances must use the same material
+	for (UMaterialInterface* CurMaterial : InInstancerMaterials)
+	{
+		if (CurMaterial != InInstancerMaterials[0])
+			return false;
+	}
+
+	HAPI_AttributeOwner Owner = HAPI_ATTROWNER_DETAIL;
+	bool bCollapse = FHoudiniEngineUtils::HapiCheckAttributeExists(
+		InGeoId, InPartId, HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES_COLLAPSE, Owner);
+
+	if (!bCollapse)
+	{
+		// Try on primitive
+		Owner = HAPI_ATTROWNER_PRIM;
+		bCollapse = FHoudiniEngineUtils::HapiCheckAttributeExists(
+			InGeoId, InPartId, HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES_COLLAPSE, Owner);
+	}
+
+	if (!bCollapse)
+		return false;
+
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES_COLLAPSE,
+		Owner, &AttributeInfo), false);
+
+	if (!AttributeInfo.exists || AttributeInfo.count <= 0)
+		return false;
+
+	TArray<int32> IntData;
+	// Allocate sufficient buffer for data.
+	IntData.SetNumZeroed(AttributeInfo.count * AttributeInfo.tupleSize);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetAttributeIntData(
+		FHoudiniEngine::Get().GetSession(),
+		InGeoId, InPartId, HAPI_UNREAL_ATTRIB_SPLIT_INSTANCES_COLLAPSE,
+		&AttributeInfo, 0, &IntData[0], 0, AttributeInfo.count), false);
+
+	return (IntData[0] != 0);
+}
+
+bool
+FHoudiniInstanceTranslator::GetPerInstanceCustomData(
+	const int32& InGeoId,
+	const int32& InPartId,
+	const int32& InNumInstances,
+	int32& OutNumCustomDataFloats,
+	TArray<float>& OutCustomData)
+{
+	OutNumCustomDataFloats = 0;
+	OutCustomData.Empty();
+
+	if (InNumInstances <= 0)
+		return false;
+
+	// Look for unreal_per_instance_custom_data0, 1, 2... until one is missing
+	// Each attribute adds its tuple size to the number of custom data floats
+	TArray<TArray<float>> AllAttributeValues;
+	TArray<int32> AllTupleSizes;
+	for (int32 AttribIdx = 0;; AttribIdx++)
+	{
+		const FString AttribName = TEXT(HAPI_UNREAL_ATTRIB_INSTANCE_CUSTOM_DATA_PREFIX) + FString::FromInt(AttribIdx);
+
+		HAPI_AttributeInfo AttribInfo;
+		FHoudiniApi::AttributeInfo_Init(&AttribInfo);
+		TArray<float> AttributeValues;
+		if (!FHoudiniEngineUtils::HapiGetAttributeDataAsFloat(
+			InGeoId, InPartId, TCHAR_TO_ANSI(*AttribName),
+			AttribInfo, AttributeValues, 0, HAPI_ATTROWNER_POINT))
+			break;
+
+		if (!AttribInfo.exists)
+			break;
+
+		if (AttribInfo.count != InNumInstances || AttribInfo.tupleSize <= 0 || AttributeValues.Num() != InNumInstances * AttribInfo.tupleSize)
+		{
+			HOUDINI_LOG_WARNING(TEXT("Ignoring per-instance custom data attribute %s: invalid number of values."), *AttribName);
+			break;
+		}
+
+		OutNumCustomDataFloats += AttribInfo.tupleSize;
+		AllTupleSizes.Add(AttribInfo.tupleSize);
+		AllAttributeValues.Add(MoveTemp(AttributeValues));
+	}
+
+	if (OutNumCustomDataFloats <= 0)
+		return false;
+
+	// Interleave the attribute values per instance
+	OutCustomData.SetNumUninitialized(InNumInstances * OutNumCustomDataFloats);
+	ParallelFor(InNumInstances, [&](int32 InstIdx)
+	{
+		float* InstanceCustomData = OutCustomData.GetData() + InstIdx * OutNumCustomDataFloats;
+		for (int32 AttribIdx = 0; AttribIdx < AllAttributeValues.Num(); AttribIdx++)
+		{
+			const int32& TupleSize = AllTupleSizes[AttribIdx];
+			FMemory::Memcpy(InstanceCustomData, AllAttributeValues[AttribIdx].GetData() + InstIdx * TupleSize, TupleSize * sizeof(float));
+			InstanceCustomData += TupleSize;
+		}
+	});
+
+	return true;
+}
+
+bool
+FHoudiniInstanceTranslator::GetInstanceColors(
+	const FHoudiniGeoPartObject& InHGPO,
+	TArray<FLinearColor>& OutInstanceColors)
+{
+	OutInstanceColors.Empty();
+	bool ColorOverrideAttributeFound = false;
+
+	// Look for the unreal_instance_color attribute on points	
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartId,
+		HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, HAPI_AttributeOwner::HAPI_ATTROWNER_POINT, &AttributeInfo))
+	{
+		ColorOverrideAttributeFound = AttributeInfo.exists;
+	}
+	
+	// Look for the unreal_instance_color attribute on prims? (why? original code)
+	if (!ColorOverrideAttributeFound)
+	{
+		if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeInfo(
+			FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartId,
+			HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, HAPI_AttributeOwner::HAPI_ATTROWNER_PRIM, &AttributeInfo))
+		{
+			ColorOverrideAttributeFound = AttributeInfo.exists;
+		}
+	}
+
+	if (ColorOverrideAttributeFound)
+	{
+		if (AttributeInfo.tupleSize == 4)
+		{
+			// Allocate sufficient buffer for data.
+			OutInstanceColors.SetNumZeroed(AttributeInfo.count);
+
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartId,
+				HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, &AttributeInfo, -1, (float*)OutInstanceColors.GetData(), 0, AttributeInfo.count))
+			{
+				OutInstanceColors.Empty();
+			}
+		}
+		else if (AttributeInfo.tupleSize == 3)
+		{
+			// Allocate sufficient buffer for data.
+			TArray<float> FloatValues;			
+			FloatValues.SetNumZeroed(AttributeInfo.count * AttributeInfo.tupleSize);
+			if (HAPI_RESULT_SUCCESS == FHoudiniApi::GetAttributeFloatData(
+				FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartId,
+				HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, &AttributeInfo, -1, (float*)FloatValues.GetData(), 0, AttributeInfo.count))
+			{
+
+				// Allocate sufficient buffer for data.
+				OutInstanceColors.SetNumZeroed(AttributeInfo.count);
+
+				// Convert float to FLinearColors
+				for (int32 ColorIdx = 0; ColorIdx < OutInstanceColors.Num(); ColorIdx++)
+				{
+					OutInstanceColors[ColorIdx].R = FloatValues[ColorIdx * AttributeInfo.tupleSize + 0];
+					OutInstanceColors[ColorIdx].G = FloatValues[ColorIdx * AttributeInfo.tupleSize + 1];
+					OutInstanceColors[ColorIdx].B = FloatValues[ColorIdx * AttributeInfo.tupleSize + 2];
+					OutInstanceColors[ColorIdx].A = 1.0;
+				}
+				FloatValues.Empty();
+			}
+		}
+		else
+		{
+			HOUDINI_LOG_WARNING(TEXT(HAPI_UNREAL_ATTRIB_INSTANCE_COLOR " must be a float[4] or float[3] prim/point attribute"));
+		}
+	}
+
+	return OutInstanceColors.Num() > 0;
+}
+
+bool
+FHoudiniInstanceTranslator::HasPointInstanceColors(const FHoudiniGeoPartObject& InHGPO)
+{
+	HAPI_AttributeInfo AttributeInfo;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfo);
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetAttributeInfo(
+		FHoudiniEngine::Get().GetSession(), InHGPO.GeoId, InHGPO.PartId,
+		HAPI_UNREAL_ATTRIB_INSTANCE_COLOR, HAPI_AttributeOwner::HAPI_ATTROWNER_POINT, &AttributeInfo))
+		return false;
+
+	return AttributeInfo.exists && (AttributeInfo.tupleSize == 3 || AttributeInfo.tupleSize == 4);
+}
+
+bool
+FHoudiniInstanceTranslator::GetSplitInstanceColors(
+	const FHoudiniGeoPartObject& InHGPO,
+	const int32& InNumInstances,
+	const TArray<float>& InCustomData,
+	const int32& InNumCustomDataFloats,
+	TArray<FLinearColor>& OutInstanceColors,
+	int32& OutNumColorFloats)
+{
+	OutInstanceColors.Empty();
+	OutNumColorFloats = 0;
+
+	if (InHGPO.InstancerType == EHoudiniInstancerType::AttributeInstancer && HasPointInstanceColors(InHGPO))
+	{
+		// The colors have been gathered with the subset's custom data
+		if (InNumCustomDataFloats < 4 || InCustomData.Num() != InNumInstances * InNumCustomDataFloats)
+			return false;
+
+		OutNumColorFloats = 4;
+		OutInstanceColors.SetNumUninitialized(InNumInstances);
+		for (int32 InstIdx = 0; InstIdx < InNumInstances; InstIdx++)
+			FMemory::Memcpy(&OutInstanceColors[InstIdx], InCustomData.GetData() + InstIdx * InNumCustomDataFloats, sizeof(FLinearColor));
+
+		return true;
+	}
+
+	// We can't tell which of the instancer's colors belong to the subset, unless it has all of them
+	if (!GetInstanceColors(InHGPO, OutInstanceColors))
+		return false;
+
+	if (OutInstanceColors.Num() != InNumInstances)
+	{
+		OutInstanceColors.Empty();
+		return false;
+	}
+
+	return true;
+}
+
 bool
 FHoudiniInstanceTranslator::IsFoliageInstancer(const int32& InGeoId, const int32& InPartId)
 {
@@ -2845,6 +3533,55 @@ FHoudiniInstanceTranslator::SpawnInstanceActor(const FTransform& InTransform, UL
 }
 
 
+bool
+FHoudiniInstanceTranslator::SpawnPendingInstancedActors(UHoudiniInstancedActorComponent* InIAC, const double& InTimeBudget)
+{
+	if (!InIAC || InIAC->IsPendingKill())
+		return true;
+
+	TArray<int32>& PendingIndices = InIAC->GetPendingSpawnIndicesForWrite();
+	TArray<FTransform>& PendingTransforms = InIAC->GetPendingSpawnTransformsForWrite();
+	if (PendingIndices.Num() <= 0)
+		return true;
+
+	ULevel* SpawnLevel = InIAC->GetOwner() ? InIAC->GetOwner()->GetLevel() : nullptr;
+	if (!SpawnLevel)
+	{
+		InIAC->ClearPendingSpawns();
+		return true;
+	}
+
+	const TArray<FHoudiniGenericAttribute>& PropertyAttributes = InIAC->GetPendingSpawnPropertyAttributesForWrite();
+	const double EndTime = FPlatformTime::Seconds() + InTimeBudget;
+
+	// Spawn at least one actor per call so we always make progress
+	int32 NumSpawned = 0;
+	while (NumSpawned < PendingIndices.Num())
+	{
+		const int32& Idx = PendingIndices[NumSpawned];
+		const FTransform& CurTransform = PendingTransforms[NumSpawned];
+		NumSpawned++;
+
+		AActor* CurInstance = SpawnInstanceActor(CurTransform, SpawnLevel, InIAC);
+		if (InIAC->SetInstanceAt(Idx, CurTransform, CurInstance))
+			UpdateGenericPropertiesAttributes(CurInstance, PropertyAttributes, Idx);
+
+		if (InTimeBudget > 0.0 && FPlatformTime::Seconds() >= EndTime)
+			break;
+	}
+
+	if (NumSpawned >= PendingIndices.Num())
+	{
+		InIAC->ClearPendingSpawns();
+		return true;
+	}
+
+	PendingIndices.RemoveAt(0, NumSpawned, false);
+	PendingTransforms.RemoveAt(0, NumSpawned, false);
+	return false;
+}
+
+
 void 
 FHoudiniInstanceTranslator::CleanupFoliageInstances(/*const FHoudiniInstancedOutput& InInstancedOutput,*/ UHierarchicalInstancedStaticMeshComponent* InFoliageHISMC, USceneComponent* InParentComponent)
 {
@@ -2997,6 +3734,13 @@ void FHoudiniInstancedOutputPartData::BuildFlatInstancedTransformsAndObjectPaths
 		OriginalInstancedTransformsFlat.Append(Transforms);
 	}
 
+	OriginalInstancedCustomDataFlat.Empty();
+	if (NumCustomDataFloats > 0)
+	{
+		for (const TArray<float>& CustomData : OriginalInstancedCustomData)
+			OriginalInstancedCustomDataFlat.Append(CustomData);
+	}
+
 	OriginalInstanceObjectPackagePaths.Empty();
 	for (const UObject* Obj : OriginalInstancedObjects)
 	{
@@ -3027,6 +3771,23 @@ void FHoudiniInstancedOutputPartData::BuildOriginalInstancedTransformsAndObjectA
 		ObjectIndexOffset += NumInstances;
 	}
 
+	// The custom data is only valid if there's a value for each of the instances
+	OriginalInstancedCustomData.Init(TArray<float>(), NumObjects);
+	if (NumCustomDataFloats > 0 && OriginalInstancedCustomDataFlat.Num() == ObjectIndexOffset * NumCustomDataFloats)
+	{
+		int32 CustomDataOffset = 0;
+		for (int32 ObjIndex = 0; ObjIndex < NumObjects; ++ObjIndex)
+		{
+			const int32 NumValues = NumInstancedTransformsPerObject[ObjIndex] * NumCustomDataFloats;
+			OriginalInstancedCustomData[ObjIndex].Append(OriginalInstancedCustomDataFlat.GetData() + CustomDataOffset, NumValues);
+			CustomDataOffset += NumValues;
+		}
+	}
+	else
+	{
+		NumCustomDataFloats = 0;
+	}
+
 	OriginalInstancedObjects.Empty();
 	for (const FString& PackageFullPath : OriginalInstanceObjectPackagePaths)
 	{
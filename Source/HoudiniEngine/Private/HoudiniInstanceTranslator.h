@@ -40,6 +40,7 @@ class UStaticMesh;
 class UFoliageType;
 class UHoudiniStaticMesh;
 class UHoudiniInstancedActorComponent;
+class UInstancedStaticMeshComponent;
 
 USTRUCT()
 struct HOUDINIENGINE_API FHoudiniInstancedOutputPerSplitAttributes
@@ -85,6 +86,15 @@ public:
 	UPROPERTY()
 	TArray<FTransform> OriginalInstancedTransformsFlat;
 
+	// Per-instance custom data for each original object, NumCustomDataFloats values per instance
+	TArray<TArray<float>> OriginalInstancedCustomData;
+
+	UPROPERTY()
+	int32 NumCustomDataFloats = 0;
+
+	UPROPERTY()
+	TArray<float> OriginalInstancedCustomDataFlat;
+
 	UPROPERTY()
 	FString SplitAttributeName;
 	
@@ -151,6 +161,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<UHoudiniOutput*>& InAllOutputs,
 			TArray<UObject*>& OutInstancedObjects,
 			TArray<TArray<FTransform>>& OutInstancedTransforms,
+			TArray<TArray<float>>& OutInstancedCustomData,
+			int32& OutNumCustomDataFloats,
 			FString& OutSplitAttributeName,
 			TArray<FString>& OutSplitAttributeValues,
 			TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes);
@@ -167,6 +179,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniGeoPartObject& InHGPO,
 			TArray<UObject*>& OutInstancedObjects,
 			TArray<TArray<FTransform>>& OutInstancedTransforms,
+			TArray<TArray<float>>& OutInstancedCustomData,
+			int32& OutNumCustomDataFloats,
 			FString& OutSplitAttributeName,
 			TArray<FString>& OutSplitAttributeValue,
 			TMap<FString, FHoudiniInstancedOutputPerSplitAttributes>& OutPerSplitAttributes);
@@ -188,9 +202,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniOutputObjectIdentifier& InOutputIdentifier,
 			const TArray<UObject*>& InOriginalObjects,
 			const TArray<TArray<FTransform>>& InOriginalTransforms,
+			const TArray<TArray<float>>& InOriginalCustomData,
+			const int32& InNumCustomDataFloats,
 			TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancedOutput>& InstancedOutputs,
 			TArray<TSoftObjectPtr<UObject>>& OutVariationsInstancedObjects,
 			TArray<TArray<FTransform>>& OutVariationsInstancedTransforms,
+			TArray<TArray<float>>& OutVariationsInstancedCustomData,
 			TArray<int32>& OutVariationOriginalObjectIdx,
 			TArray<int32>& OutVariationIndices);
 
@@ -205,11 +222,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 		static void UpdateVariationAssignements(
 			FHoudiniInstancedOutput& InstancedOutput);
 
-		// Extracts the final transforms (with the transform offset applied) for a given variation
+		// Extracts the final transforms (with the transform offset applied) for all the variations at once
+		// If OutProcessedCustomData is set, the per-instance custom data is split between the variations as well
 		static void ProcessInstanceTransforms(
 			FHoudiniInstancedOutput& InstancedOutput,
-			const int32& VariationIdx,
-			TArray<FTransform>& OutProcessedTransforms);
+			TArray<TArray<FTransform>>& OutProcessedTransforms,
+			TArray<TArray<float>>* OutProcessedCustomData = nullptr);
 
 		// Creates a new component or updates the previous one if possible
 		static bool CreateOrUpdateInstanceComponent(
@@ -224,7 +242,9 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const bool& InIsFoliageInstancer,
 			const TArray<UMaterialInterface *>& InstancerMaterials,
 			const int32& InstancerObjectIdx = 0,
-			const bool& bForceHISM = false);
+			const bool& bForceHISM = false,
+			const TArray<float>& InstancedObjectCustomData = TArray<float>(),
+			const int32& InNumCustomDataFloats = 0);
 
 		// Create or update an ISMC / HISMC
 		static bool CreateOrUpdateInstancedStaticMeshComponent(
@@ -235,7 +255,22 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			USceneComponent* ParentComponent,
 			USceneComponent*& CreatedInstancedComponent,
 			UMaterialInterface * InstancerMaterial = nullptr,
-			const bool& bForceHISM = false);
+			const bool& bForceHISM = false,
+			const int32& InNumCustomDataFloats = 0,
+			const TArray<float>& InCustomData = TArray<float>());
+
+		// Update the instances of an ISMC / HISMC, only touching the instances whose transform has changed
+		// and adding or removing instances to match the new number of transforms
+		static void UpdateInstancedStaticMeshComponentInstances(
+			UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+			const TArray<FTransform>& InstancedObjectTransforms);
+
+		// Set the per-instance custom data of an ISMC / HISMC, InCustomData contains InNumCustomDataFloats values per instance.
+		// Components that aren't registered yet get all their data in one copy, otherwise only the values that have changed are updated.
+		static void UpdateInstancedStaticMeshComponentCustomData(
+			UInstancedStaticMeshComponent* InstancedStaticMeshComponent,
+			const int32& InNumCustomDataFloats,
+			const TArray<float>& InCustomData);
 
 		// Create or update an IAC
 		static bool CreateOrUpdateInstancedActorComponent(
@@ -253,7 +288,8 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const FHoudiniGeoPartObject& InstancerGeoPartObject,
 			USceneComponent* ParentComponent,
 			USceneComponent*& CreatedInstancedComponent,
-			const TArray<UMaterialInterface *>& InstancerMaterials);
+			const TArray<UMaterialInterface *>& InstancerMaterials,
+			const TArray<FLinearColor>& InInstanceColors);
 
 		// Create or update a StaticMeshComponent (when we have only one instance)
 		static bool CreateOrUpdateStaticMeshComponent(
@@ -303,6 +339,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			ULevel* InSpawnLevel, 
 			UHoudiniInstancedActorComponent* InIAC);
 
+		// Spawns the pending actors of an IAC until the time budget (in seconds) is spent.
+		// A budget <= 0 spawns all of them. Returns true when no spawns are left pending.
+		static bool SpawnPendingInstancedActors(
+			UHoudiniInstancedActorComponent* InIAC,
+			const double& InTimeBudget);
+
 		// Helper functions for generic property attributes
 		static bool GetGenericPropertiesAttributes(
 			const int32& InGeoNodeId,
@@ -314,6 +356,12 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes,
 			const int32& AtIndex);
 
+		// Applies the property attributes to all the instances at once, each instance using the values at its index.
+		// Null instances are skipped. Returns the number of instances that were modified.
+		static int32 UpdateGenericPropertiesAttributesOnInstances(
+			const TArray<UObject*>& InInstances,
+			const TArray<FHoudiniGenericAttribute>& InAllPropertyAttributes);
+
 		static bool GetMaterialOverridesFromAttributes(
 			const int32& InGeoNodeId,
 			const int32& InPartId, 
@@ -338,6 +386,43 @@ struct HOUDINIENGINE_API FHoudiniInstanceTranslator
 			const int32& InGeoId, 
 			const int32& InPartId);
 
+		// Returns true if a split instancer can be collapsed to an ISM / HISM with per-instance colors:
+		// requires the collapse attribute, no property attributes and the same material on all instances
+		static bool IsCollapsibleSplitInstancer(
+			const int32& InGeoId,
+			const int32& InPartId,
+			const TArray<FHoudiniGenericAttribute>& AllPropertyAttributes,
+			const TArray<UMaterialInterface*>& InInstancerMaterials);
+
+		// Reads the per-instance custom data from the unreal_per_instance_custom_data0, 1, 2... point attributes.
+		// OutCustomData is interleaved per instance, with OutNumCustomDataFloats values for each of them.
+		static bool GetPerInstanceCustomData(
+			const int32& InGeoId,
+			const int32& InPartId,
+			const int32& InNumInstances,
+			int32& OutNumCustomDataFloats,
+			TArray<float>& OutCustomData);
+
+		// Reads the per-instance colors (unreal_instance_color point or prim attribute)
+		static bool GetInstanceColors(
+			const FHoudiniGeoPartObject& InHGPO,
+			TArray<FLinearColor>& OutInstanceColors);
+
+		// Returns true if the instancer has a valid unreal_instance_color point attribute.
+		// The point colors of split attribute instancers are stored in the first 4 floats of the per-instance custom data.
+		static bool HasPointInstanceColors(const FHoudiniGeoPartObject& InHGPO);
+
+		// Returns the colors of a subset of a split instancer's instances, from their custom data for attribute instancers.
+		// Other instancers only have colors if the subset contains all the instancer's points.
+		// OutNumColorFloats is the number of custom data floats used by the colors.
+		static bool GetSplitInstanceColors(
+			const FHoudiniGeoPartObject& InHGPO,
+			const int32& InNumInstances,
+			const TArray<float>& InCustomData,
+			const int32& InNumCustomDataFloats,
+			TArray<FLinearColor>& OutInstanceColors,
+			int32& OutNumColorFloats);
+
 		static bool IsFoliageInstancer(
 			const int32& InGeoId,
 			const int32& InPartId);
@@ -71,6 +71,7 @@
 #include "Misc/AssetRegistryInterface.h"
 #include "Misc/StringFormatArg.h"
 #include "Engine/WorldComposition.h"
+#include "Async/ParallelFor.h"
 
 #if WITH_EDITOR
 	#include "LandscapeEditorModule.h"
@@ -89,6 +90,107 @@ static TAutoConsoleVariable<int32> CVarHoudiniEngineExportLandscapeTextures(
 	TEXT("1: Enabled\n")
 );
 
+// Compares the new landscape data with the landscape's current data, one landscape component at a time.
+// Returns the number of components whose data differ, and the regions (inclusive, in vertices) to rewrite.
+// Changed components that are adjacent on a row are merged into a single region.
+template<typename T>
+int32 GetChangedComponentRegions(
+	const TArray<T>& NewData, const TArray<T>& CurrentData,
+	int32 SizeX, int32 SizeY, int32 ComponentSizeQuads,
+	TArray<FIntRect>& OutChangedRegions)
+{
+	OutChangedRegions.Empty();
+	if (SizeX < 2 || SizeY < 2)
+		return 0;
+
+	const int32 NumComponentsX = FMath::Max((SizeX - 1) / FMath::Max(ComponentSizeQuads, 1), 1);
+	const int32 NumComponentsY = FMath::Max((SizeY - 1) / FMath::Max(ComponentSizeQuads, 1), 1);
+	if (ComponentSizeQuads <= 0 || NewData.Num() != SizeX * SizeY || CurrentData.Num() != NewData.Num())
+	{
+		// Can't compare, rewrite everything
+		OutChangedRegions.Add(FIntRect(0, 0, SizeX - 1, SizeY - 1));
+		return NumComponentsX * NumComponentsY;
+	}
+
+	// Components share their edge vertices, so a change on an edge marks both components
+	auto GetComponentRegion = [&](int32 ComponentX, int32 ComponentY)
+	{
+		FIntRect Region(ComponentX * ComponentSizeQuads, ComponentY * ComponentSizeQuads, 
+			(ComponentX + 1) * ComponentSizeQuads, (ComponentY + 1) * ComponentSizeQuads);
+
+		// The last components take any leftover vertices
+		if (ComponentX == NumComponentsX - 1)
+			Region.Max.X = SizeX - 1;
+		if (ComponentY == NumComponentsY - 1)
+			Region.Max.Y = SizeY - 1;
+
+		return Region;
+	};
+
+	TArray<bool> ComponentChanged;
+	ComponentChanged.SetNumZeroed(NumComponentsX * NumComponentsY);
+	ParallelFor(ComponentChanged.Num(), [&](int32 ComponentIdx)
+	{
+		const FIntRect Region = GetComponentRegion(ComponentIdx % NumComponentsX, ComponentIdx / NumComponentsX);
+		const int32 RowSize = (Region.Max.X - Region.Min.X + 1) * sizeof(T);
+
+		// Compare the rows directly, stopping at the first difference
+		for (int32 Y = Region.Min.Y; Y <= Region.Max.Y; Y++)
+		{
+			const int32 RowStart = Y * SizeX + Region.Min.X;
+			if (FMemory::Memcmp(&NewData[RowStart], &CurrentData[RowStart], RowSize) != 0)
+			{
+				ComponentChanged[ComponentIdx] = true;
+				break;
+			}
+		}
+	});
+
+	int32 NumChangedComponents = 0;
+	for (int32 ComponentY = 0; ComponentY < NumComponentsY; ComponentY++)
+	{
+		for (int32 ComponentX = 0; ComponentX < NumComponentsX; ComponentX++)
+		{
+			if (!ComponentChanged[ComponentY * NumComponentsX + ComponentX])
+				continue;
+
+			FIntRect Region = GetComponentRegion(ComponentX, ComponentY);
+			NumChangedComponents++;
+
+			while (ComponentX + 1 < NumComponentsX && ComponentChanged[ComponentY * NumComponentsX + ComponentX + 1])
+			{
+				ComponentX++;
+				Region.Max.X = GetComponentRegion(ComponentX, ComponentY).Max.X;
+				NumChangedComponents++;
+			}
+
+			OutChangedRegions.Add(Region);
+		}
+	}
+
+	return NumChangedComponents;
+}
+
+// Extracts the data of a region (inclusive, in vertices) of the landscape data
+template<typename T>
+TArray<T> GetRegionData(const TArray<T>& Data, int32 SizeX, const FIntRect& Region)
+{
+	const int32 RegionSizeX = Region.Max.X - Region.Min.X + 1;
+	const int32 RegionSizeY = Region.Max.Y - Region.Min.Y + 1;
+
+	TArray<T> Result;
+	Result.SetNumUninitialized(RegionSizeX * RegionSizeY);
+	for (int32 Y = 0; Y < RegionSizeY; Y++)
+	{
+		FMemory::Memcpy(
+			&Result[Y * RegionSizeX], 
+			&Data[(Region.Min.Y + Y) * SizeX + Region.Min.X], 
+			RegionSizeX * sizeof(T));
+	}
+
+	return Result;
+}
+
 typedef FHoudiniEngineUtils FHUtils;
 
 bool
@@ -316,7 +418,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	const FHoudiniVolumeInfo &VolumeInfo = Heightfield->VolumeInfo;
 	TArray<float> FloatValues;
 	float FloatMin, FloatMax;
-	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax))
+	if (!GetHoudiniHeightfieldFloatData(Heightfield, FloatValues, FloatMin, FloatMax, false))
 		return false;
 
 	// Heightfield conversions should always use the global float min/max
@@ -397,6 +499,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 	bool bTilePhysicalMaterialChanged = false;
 	bool bCreatedMap = false;
 	bool bCreatedTileActor = false;
+	bool bModifiedTileTransform = false;
 	bool bHeightLayerDataChanged = false;
 	bool bCustomLayerDataChanged = false;
 
@@ -783,6 +886,7 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 			GEngine->BroadcastOnActorMoved(TileActor);
 #endif
 			LandscapeInfo->RecreateLandscapeInfo(InWorld,true);
+			bModifiedTileTransform = true;
 		}
 		
 		// Update existing landscape / tile
@@ -836,23 +940,76 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		// NOTE: Use HeightmapAccessor / AlphamapAccessor instead of FLandscapeEditDataInterface.
 		// FLandscapeEditDataInterface is a more low level data interface, used internally by the *Accessor tools
 		// though the *Accessors do additional things like update normals and foliage.
+		// The new data is compared to the landscape's current data per component, and only the changed
+		// components are written, so that collision, grass and navigation are only rebuilt for those.
+		const int32 ComponentSizeQuads = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+		const int32 NumComponents = FMath::Max((UnrealTileSizeX - 1) / ComponentSizeQuads, 1) * FMath::Max((UnrealTileSizeY - 1) / ComponentSizeQuads, 1);
 		
 		// Update height if it has been changed.
 		if (Heightfield->bHasGeoChanged)
 		{
-			// It is important to update the heightmap through the this since it will properly
-			// update normals and foliage.
-			FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
-			HeightmapAccessor.SetData(MinX, MinY, MaxX, MaxY, IntHeightData.GetData());
+			TArray<uint16> CurrentHeightData;
+			CurrentHeightData.AddZeroed(UnrealTileSizeX * UnrealTileSizeY);
+			{
+				FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+				LandscapeEdit.GetHeightDataFast(MinX, MinY, MaxX, MaxY, CurrentHeightData.GetData(), 0);
+			}
+
+			TArray<FIntRect> ChangedRegions;
+			int32 NumChangedComponents = GetChangedComponentRegions(
+				IntHeightData, CurrentHeightData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, ChangedRegions);
+
+			if (ChangedRegions.Num() > 0)
+			{
+				// It is important to update the heightmap through the this since it will properly
+				// update normals and foliage.
+				FHeightmapAccessor<false> HeightmapAccessor(LandscapeInfo);
+				for (const FIntRect& CurrentRegion : ChangedRegions)
+				{
+					TArray<uint16> RegionData = GetRegionData(IntHeightData, UnrealTileSizeX, CurrentRegion);
+					HeightmapAccessor.SetData(
+						MinX + CurrentRegion.Min.X, MinY + CurrentRegion.Min.Y,
+						MinX + CurrentRegion.Max.X, MinY + CurrentRegion.Max.Y,
+						RegionData.GetData());
+				}
 
-			bHeightLayerDataChanged = true;
+				bHeightLayerDataChanged = true;
+			}
+
+			HOUDINI_LOG_VERBOSE(TEXT("[CreateLandscape] %s: updated height for %d / %d components."), 
+				*LandscapeTileActorName, NumChangedComponents, NumComponents);
 		}
 
 		// Update the layers on the landscape.
 		for (FLandscapeImportLayerInfo &NextUpdatedLayerInfo : LayerInfos)
 		{
-			FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
-			AlphaAccessor.SetData(MinX, MinY, MaxX, MaxY, NextUpdatedLayerInfo.LayerData.GetData(), ELandscapeLayerPaintingRestriction::None);
+			TArray<uint8> CurrentLayerData;
+			CurrentLayerData.AddZeroed(UnrealTileSizeX * UnrealTileSizeY);
+			if (NextUpdatedLayerInfo.LayerInfo)
+			{
+				// Read with a fresh interface, as normalized writes to the previous layers can modify this one
+				FLandscapeEditDataInterface LandscapeEdit(LandscapeInfo);
+				LandscapeEdit.GetWeightDataFast(NextUpdatedLayerInfo.LayerInfo, MinX, MinY, MaxX, MaxY, CurrentLayerData.GetData(), 0);
+			}
+
+			TArray<FIntRect> ChangedRegions;
+			GetChangedComponentRegions(
+				NextUpdatedLayerInfo.LayerData, CurrentLayerData, UnrealTileSizeX, UnrealTileSizeY, ComponentSizeQuads, ChangedRegions);
+
+			if (ChangedRegions.Num() > 0)
+			{
+				FAlphamapAccessor<false, true> AlphaAccessor(LandscapeInfo, NextUpdatedLayerInfo.LayerInfo);
+				for (const FIntRect& CurrentRegion : ChangedRegions)
+				{
+					TArray<uint8> RegionData = GetRegionData(NextUpdatedLayerInfo.LayerData, UnrealTileSizeX, CurrentRegion);
+					AlphaAccessor.SetData(
+						MinX + CurrentRegion.Min.X, MinY + CurrentRegion.Min.Y,
+						MinX + CurrentRegion.Max.X, MinY + CurrentRegion.Max.Y,
+						RegionData.GetData(), ELandscapeLayerPaintingRestriction::None);
+				}
+
+				bCustomLayerDataChanged = true;
+			}
 		
 			if (NextUpdatedLayerInfo.LayerInfo && NextUpdatedLayerInfo.LayerName.ToString().Equals(TEXT("Visibility"), ESearchCase::IgnoreCase))
 			{
@@ -860,11 +1017,10 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 				TileActor->VisibilityLayer->bNoWeightBlend = true;
 				TileActor->VisibilityLayer->AddToRoot();
 			}
-
-			bCustomLayerDataChanged = true;
 		}
 
-		bModifiedLandscapeActor = true;
+		// Unchanged tiles don't need a full actor update
+		bModifiedLandscapeActor |= (bHeightLayerDataChanged || bCustomLayerDataChanged);
 	}
 
 	// ----------------------------------------------------
@@ -940,11 +1096,14 @@ FHoudiniLandscapeTranslator::CreateLandscape(
 		SharedLandscapeActor->PostEditChange();
 	}
 
-	if (bModifiedLandscapeActor)
+	if (bModifiedLandscapeActor || bModifiedTileTransform)
 	{
 		TileActor->PostEditChange();
 	}
 
+	// The accessors already recalculate the normals of the components they update,
+	// so the whole landscape only needs it when the tile was just created or moved
+	if (bCreatedTileActor || bModifiedTileTransform)
 	{
 		FLandscapeEditDataInterface LandscapeEdit(TileActor->GetLandscapeInfo());
 		LandscapeEdit.RecalculateNormals();
@@ -1998,7 +2157,8 @@ FHoudiniLandscapeTranslator::GetHeightfieldsLayersFromOutput(const UHoudiniOutpu
 }
 
 bool 
-FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPartObject* HGPO, TArray<float> &OutFloatArr, float &OutFloatMin, float &OutFloatMax) 
+FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(
+	const FHoudiniGeoPartObject* HGPO, TArray<float> &OutFloatArr, float &OutFloatMin, float &OutFloatMax, const bool& bInComputeMinMax) 
 {
 	OutFloatArr.Empty();
 	OutFloatMin = 0.f;
@@ -2037,21 +2197,57 @@ FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(const FHoudiniGeoPar
 		HGPO->GeoId, HGPO->PartId,
 		OutFloatArr.GetData(),
 		0, SizeInPoints), false);
-	
-	OutFloatMin = OutFloatArr[0];
-	OutFloatMax = OutFloatMin;
 
-	for (float NextFloatVal : OutFloatArr) 
+	// Callers that use global ranges can skip the min/max pass
+	if (bInComputeMinMax)
+		GetFloatArrayMinMax(OutFloatArr, OutFloatMin, OutFloatMax);
+
+	return true;
+}
+
+void
+FHoudiniLandscapeTranslator::GetFloatArrayMinMax(const TArray<float>& InFloatArr, float& OutFloatMin, float& OutFloatMax)
+{
+	OutFloatMin = 0.f;
+	OutFloatMax = 0.f;
+
+	const int32 NumValues = InFloatArr.Num();
+	if (NumValues <= 0)
+		return;
+
+	// Reduce each chunk concurrently, then merge the chunks' results
+	const int32 ChunkSize = 64 * 1024;
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumValues, ChunkSize);
+	TArray<float> ChunkMinimums;
+	TArray<float> ChunkMaximums;
+	ChunkMinimums.SetNumUninitialized(NumChunks);
+	ChunkMaximums.SetNumUninitialized(NumChunks);
+
+	const float* FloatData = InFloatArr.GetData();
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
 	{
-		if (NextFloatVal > OutFloatMax)
+		const int32 ChunkStart = ChunkIdx * ChunkSize;
+		const int32 ChunkEnd = FMath::Min(ChunkStart + ChunkSize, NumValues);
+
+		float ChunkMin = FloatData[ChunkStart];
+		float ChunkMax = ChunkMin;
+		for (int32 Idx = ChunkStart + 1; Idx < ChunkEnd; Idx++)
 		{
-			OutFloatMax = NextFloatVal;
+			ChunkMin = FMath::Min(ChunkMin, FloatData[Idx]);
+			ChunkMax = FMath::Max(ChunkMax, FloatData[Idx]);
 		}
-		else if (NextFloatVal < OutFloatMin)
-			OutFloatMin = NextFloatVal;
-	}
 
-	return true;
+		ChunkMinimums[ChunkIdx] = ChunkMin;
+		ChunkMaximums[ChunkIdx] = ChunkMax;
+	});
+
+	OutFloatMin = ChunkMinimums[0];
+	OutFloatMax = ChunkMaximums[0];
+	for (int32 ChunkIdx = 1; ChunkIdx < NumChunks; ChunkIdx++)
+	{
+		OutFloatMin = FMath::Min(OutFloatMin, ChunkMinimums[ChunkIdx]);
+		OutFloatMax = FMath::Max(OutFloatMax, ChunkMaximums[ChunkIdx]);
+	}
 }
 
 bool
@@ -2142,8 +2338,23 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 	// For Debugging, do we want to export layers as textures?
 	bool bExportTexture = CVarHoudiniEngineExportLandscapeTextures.GetValueOnAnyThread() == 1 ? true : false;
 
-	// Try to create all the layers
-	ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
+	// Layer data fetched from Houdini, kept for the conversion step
+	struct FHoudiniLayerConversion
+	{
+		const FHoudiniGeoPartObject* HGPO = nullptr;
+		TArray<float> FloatLayerData;
+		float FloatMin = 0.f;
+		float FloatMax = 0.f;
+		bool bIsUnitLayer = false;
+		float LayerMin = 0.f;
+		float LayerMax = 0.f;
+		TArray<uint8> LayerData;
+		bool bConverted = false;
+	};
+
+	// Fetch the layers' data first, HAPI calls have to stay on this thread
+	TArray<FHoudiniLayerConversion> LayerConversions;
+	LayerConversions.Reserve(FoundLayers.Num());
 	for (TArray<const FHoudiniGeoPartObject *>::TConstIterator IterLayers(FoundLayers); IterLayers; ++IterLayers)
 	{
 		const FHoudiniGeoPartObject * LayerGeoPartObject = *IterLayers;
@@ -2161,14 +2372,70 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 			continue;
 		}
 
-		TArray<float> FloatLayerData;
-		float LayerMin = 0;
-		float LayerMax = 0;
-		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(LayerGeoPartObject, FloatLayerData, LayerMin, LayerMax))
+		FHoudiniLayerConversion& CurrentConversion = LayerConversions.AddDefaulted_GetRef();
+		CurrentConversion.HGPO = LayerGeoPartObject;
+		if (!FHoudiniLandscapeTranslator::GetHoudiniHeightfieldFloatData(
+			LayerGeoPartObject, CurrentConversion.FloatLayerData, CurrentConversion.FloatMin, CurrentConversion.FloatMax, false))
+		{
+			LayerConversions.Pop(false);
 			continue;
+		}
+
+		// Check if that landscape layer has been marked as unit (range in [0-1]
+		CurrentConversion.bIsUnitLayer = IsUnitLandscapeLayer(*LayerGeoPartObject);
+	}
+
+	// Compute the layers' min/max and convert them concurrently
+	ParallelFor(LayerConversions.Num(), [&](int32 LayerIdx)
+	{
+		FHoudiniLayerConversion& CurrentConversion = LayerConversions[LayerIdx];
+		FHoudiniLandscapeTranslator::GetFloatArrayMinMax(CurrentConversion.FloatLayerData, CurrentConversion.FloatMin, CurrentConversion.FloatMax);
+
+		// No need to create flat layers as Unreal will remove them afterwards..
+		if (CurrentConversion.FloatMin == CurrentConversion.FloatMax)
+			return;
+
+		const FHoudiniVolumeInfo& LayerVolumeInfo = CurrentConversion.HGPO->VolumeInfo;
+		const FString& LayerName = LayerVolumeInfo.Name;
+
+		CurrentConversion.LayerMin = CurrentConversion.FloatMin;
+		CurrentConversion.LayerMax = CurrentConversion.FloatMax;
+		if (CurrentConversion.bIsUnitLayer)
+		{
+			CurrentConversion.LayerMin = 0.0f;
+			CurrentConversion.LayerMax = 1.0f;
+		}
+		else
+		{
+			// We want to convert the layer using the global Min/Max
+			if (const float* GlobalMax = GlobalMaximums.Find(LayerName))
+				CurrentConversion.LayerMax = *GlobalMax;
+
+			if (const float* GlobalMin = GlobalMinimums.Find(LayerName))
+				CurrentConversion.LayerMin = *GlobalMin;
+		}
+
+		// Convert the float data to uint8
+		// HF masks need their X/Y sizes swapped
+		CurrentConversion.bConverted = FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
+			CurrentConversion.FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
+			CurrentConversion.LayerMin, CurrentConversion.LayerMax,
+			LandscapeXSize, LandscapeYSize,
+			CurrentConversion.LayerData);
+
+		// The raw data is only needed afterwards for the texture exports
+		if (!bExportTexture)
+			CurrentConversion.FloatLayerData.Empty();
+	});
+
+	// Try to create all the layers
+	ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
+	for (FHoudiniLayerConversion& CurrentConversion : LayerConversions)
+	{
+		const FHoudiniGeoPartObject * LayerGeoPartObject = CurrentConversion.HGPO;
 
 		// No need to create flat layers as Unreal will remove them afterwards..
-		if (LayerMin == LayerMax)
+		if (CurrentConversion.FloatMin == CurrentConversion.FloatMax)
 			continue;
 
 		const FHoudiniVolumeInfo& LayerVolumeInfo = LayerGeoPartObject->VolumeInfo;
@@ -2189,26 +2456,16 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 				TextureName,
 				LayerVolumeInfo.YLength,  // Y and X inverted?? why?
 				LayerVolumeInfo.XLength,
-				FloatLayerData,
-				LayerMin,
-				LayerMax);
+				CurrentConversion.FloatLayerData,
+				CurrentConversion.FloatMin,
+				CurrentConversion.FloatMax);
 		}
 
-		// Check if that landscape layer has been marked as unit (range in [0-1]
-		if (IsUnitLandscapeLayer(*LayerGeoPartObject))
-		{
-			LayerMin = 0.0f;
-			LayerMax = 1.0f;
-		}
-		else
-		{
-			// We want to convert the layer using the global Min/Max
-			if (GlobalMaximums.Contains(LayerName))
-				LayerMax = GlobalMaximums[LayerName];
+		if (!CurrentConversion.bConverted)
+			continue;
 
-			if (GlobalMinimums.Contains(LayerName))
-				LayerMin = GlobalMinimums[LayerName];
-		}
+		const float LayerMin = CurrentConversion.LayerMin;
+		const float LayerMax = CurrentConversion.LayerMax;
 			
 		// Get the layer package path
 		// FString LayerNameString = FString::Printf(TEXT("%s_%d"), LayerString.GetCharArray().GetData(), (int32)LayerGeoPartObject->PartId);
@@ -2219,6 +2476,7 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 
 		// Creating the ImportLayerInfo and LayerInfo objects
 		FLandscapeImportLayerInfo ImportLayerInfo(*LayerName);
+		ImportLayerInfo.LayerData = MoveTemp(CurrentConversion.LayerData);
 
 		// See if the user has assigned a layer info object via attribute
 		UPackage * Package = nullptr;
@@ -2233,15 +2491,6 @@ FHoudiniLandscapeTranslator::CreateOrUpdateLandscapeLayers(
 		{
 			continue;
 		}
-
-		// Convert the float data to uint8
-		// HF masks need their X/Y sizes swapped
-		if (!FHoudiniLandscapeTranslator::ConvertHeightfieldLayerToLandscapeLayer(
-			FloatLayerData, LayerVolumeInfo.YLength, LayerVolumeInfo.XLength,
-			LayerMin, LayerMax,
-			LandscapeXSize, LandscapeYSize,
-			ImportLayerInfo.LayerData))
-			continue;
 		
 		// We will store the data used to convert from Houdini values to int in the DebugColor
 		// This is the only way we'll be able to reconvert those values back to their houdini equivalent afterwards...
@@ -2332,19 +2581,21 @@ FHoudiniLandscapeTranslator::CalcHeightfieldsArrayGlobalZMinZMax(
 		if (NodeId == -1)
 			continue;
 
-		// Retrieve the VolumeInfo
-		HAPI_VolumeInfo CurrentVolumeInfo;
-		FHoudiniApi::VolumeInfo_Init(&CurrentVolumeInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			NodeId, CurrentHeightfield.PartId,
-			&CurrentVolumeInfo))
-			continue;
+		// Retrieve the volume name, only query the VolumeInfo if it hasn't been cached on the HGPO
+		FString VolumeName = CurrentHeightfield.VolumeInfo.Name;
+		if (VolumeName.IsEmpty())
+		{
+			HAPI_VolumeInfo CurrentVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&CurrentVolumeInfo);
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, CurrentHeightfield.PartId,
+				&CurrentVolumeInfo))
+				continue;
 
-		// Retrieve the volume name.
-		FString VolumeName;
-		FHoudiniEngineString HoudiniEngineStringPartName(CurrentVolumeInfo.nameSH);
-		HoudiniEngineStringPartName.ToFString(VolumeName);
+			FHoudiniEngineString HoudiniEngineStringPartName(CurrentVolumeInfo.nameSH);
+			HoudiniEngineStringPartName.ToFString(VolumeName);
+		}
 
 		bool bHasMinAttr = false;
 		bool bHasMaxAttr = false;
@@ -2440,19 +2691,21 @@ FHoudiniLandscapeTranslator::GetLayersZMinZMax(
 		if (NodeId == -1)
 			continue;
 
-		// Retrieve the VolumeInfo
-		HAPI_VolumeInfo CurrentVolumeInfo;
-		FHoudiniApi::VolumeInfo_Init(&CurrentVolumeInfo);
-		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-			FHoudiniEngine::Get().GetSession(),
-			NodeId, CurrentHeightfield.PartId,
-			&CurrentVolumeInfo))
-			continue;
+		// Retrieve the volume name, only query the VolumeInfo if it hasn't been cached on the HGPO
+		FString VolumeName = CurrentHeightfield.VolumeInfo.Name;
+		if (VolumeName.IsEmpty())
+		{
+			HAPI_VolumeInfo CurrentVolumeInfo;
+			FHoudiniApi::VolumeInfo_Init(&CurrentVolumeInfo);
+			if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
+				FHoudiniEngine::Get().GetSession(),
+				NodeId, CurrentHeightfield.PartId,
+				&CurrentVolumeInfo))
+				continue;
 
-		// Retrieve the volume name.
-		FString VolumeName;
-		FHoudiniEngineString HoudiniEngineStringPartName(CurrentVolumeInfo.nameSH);
-		HoudiniEngineStringPartName.ToFString(VolumeName);
+			FHoudiniEngineString HoudiniEngineStringPartName(CurrentVolumeInfo.nameSH);
+			HoudiniEngineStringPartName.ToFString(VolumeName);
+		}
 
 		// Read the global min value for this volume
 
@@ -197,7 +197,14 @@ struct HOUDINIENGINE_API FHoudiniLandscapeTranslator
 			const FHoudiniGeoPartObject* HGPO,
 			TArray<float> &OutFloatArr,
 			float &OutFloatMin,
-			float &OutFloatMax);
+			float &OutFloatMax,
+			const bool& bInComputeMinMax = true);
+
+		// Computes the min/max values of the float array, reducing chunks of it concurrently
+		static void GetFloatArrayMinMax(
+			const TArray<float>& InFloatArr,
+			float& OutFloatMin,
+			float& OutFloatMax);
 
 		static bool CalcLandscapeSizeFromHeightfieldSize(
 			const int32& HoudiniSizeX,
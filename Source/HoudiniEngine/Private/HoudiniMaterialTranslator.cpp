@@ -37,6 +37,7 @@
 #include "Materials/Material.h"
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInstanceConstant.h"
+#include "MaterialShared.h"
 #include "PhysicalMaterials/PhysicalMaterial.h"
 
 #include "Materials/MaterialExpressionTextureSample.h"
@@ -49,6 +50,8 @@
 #include "Materials/MaterialExpressionVectorParameter.h"
 #include "Materials/MaterialExpressionScalarParameter.h"
 #include "ImageUtils.h"
+#include "Async/ParallelFor.h"
+#include "Hash/CityHash.h"
 #include "PackageTools.h"
 #include "AssetRegistryModule.h"
 #include "UObject/MetaData.h"
@@ -285,6 +288,11 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 	// This is pretty hacky and we should probably require an extra material_instance_index attribute instead.
 	// as we can only create one instance of the same material, and cant get two slots for the same "source" material.	
 	int32 MaterialIndex = 0;
+
+	// Update context for all the generated instances (will trigger when the object goes out of scope).
+	// Sharing it recreates the render state of the affected components once instead of once per instance.
+	FMaterialUpdateContext MaterialUpdateContext;
+
 	for (TMap<FString, int32>::TConstIterator Iter(UniqueMaterialInstanceOverrides); Iter; ++Iter)
 	{
 		FString CurrentSourceMaterial = Iter->Key;
@@ -361,9 +369,6 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 			continue;
 		}			
 
-		// Update context for generated materials (will trigger when the object goes out of scope).
-		FMaterialUpdateContext MaterialUpdateContext;
-
 		bool bModifiedMaterialParameters = false;
 		// See if we need to override some of the material instance's parameters
 		TArray<FHoudiniGenericAttribute> AllMatParams;
@@ -378,11 +383,39 @@ FHoudiniMaterialTranslator::CreateMaterialInstances(
 			InHGPO.GeoId, InHGPO.PartId, HAPI_UNREAL_ATTRIB_GENERIC_MAT_PARAM_PREFIX,
 			AllMatParams, HAPI_ATTROWNER_PRIM, MaterialIndexToAttributeIndex);
 
-		for (int32 ParamIdx = 0; ParamIdx < AllMatParams.Num(); ParamIdx++)
+		// Skip the update if the parameters haven't changed since they were last applied to this instance
+		const uint32 ParametersHash = GetMaterialInstanceParametersHash(CurrentSourceMaterial, AllMatParams, InPackages);
+		const FString ParametersHashString = FString::Printf(TEXT("%08x"), ParametersHash);
+		bool bParametersUpToDate = false;
+		if (!bNewMaterialCreated && !bForceRecookAll)
 		{
-			// Try to update the material instance parameter corresponding to the attribute
-			if (UpdateMaterialInstanceParameter(AllMatParams[ParamIdx], NewMaterialInstance, InPackages))
-				bModifiedMaterialParameters = true;
+			UMetaData* MetaData = MaterialInstancePackage->GetMetaData();
+			if (MetaData && !MetaData->IsPendingKill())
+			{
+				const FString& PreviousHashString = MetaData->GetValue(NewMaterialInstance, HAPI_UNREAL_PACKAGE_META_MATERIAL_PARAMETERS_HASH);
+				bParametersUpToDate = PreviousHashString.Equals(ParametersHashString);
+			}
+		}
+
+		if (!bParametersUpToDate)
+		{
+			// Static switches are gathered so the static permutation is only updated once
+			FStaticParameterSet StaticParameters;
+			NewMaterialInstance->GetStaticParameterValues(StaticParameters);
+			const FStaticParameterSet PreviousStaticParameters = StaticParameters;
+
+			for (int32 ParamIdx = 0; ParamIdx < AllMatParams.Num(); ParamIdx++)
+			{
+				// Try to update the material instance parameter corresponding to the attribute
+				if (UpdateMaterialInstanceParameter(AllMatParams[ParamIdx], NewMaterialInstance, InPackages, &StaticParameters))
+					bModifiedMaterialParameters = true;
+			}
+
+			if (!(StaticParameters == PreviousStaticParameters))
+				NewMaterialInstance->UpdateStaticPermutation(StaticParameters);
+
+			FHoudiniEngineUtils::AddHoudiniMetaInformationToPackage(
+				MaterialInstancePackage, NewMaterialInstance, HAPI_UNREAL_PACKAGE_META_MATERIAL_PARAMETERS_HASH, ParametersHashString);
 		}
 
 		// Schedule this material for update if needed.
@@ -515,7 +548,8 @@ FHoudiniMaterialTranslator::CreatePackageForTexture(
 	const HAPI_NodeId& InMaterialNodeId,
 	const FString& InTextureType,
 	const FHoudiniPackageParams& InPackageParams,
-	FString& OutTextureName)
+	FString& OutTextureName,
+	const bool& bInCreateNewPackage)
 {
 	FString TextureInfoDescriptor = TEXT("_texture_") + FString::FromInt(InMaterialNodeId) + TEXT("_") + InTextureType;
 	FHoudiniPackageParams MyPackageParams = InPackageParams;
@@ -533,6 +567,10 @@ FHoudiniMaterialTranslator::CreatePackageForTexture(
 	}
 	MyPackageParams.PackageMode = FHoudiniPackageParams::GetDefaultMaterialAndTextureCookMode();
 
+	// Don't replace the texture that's currently in the package
+	if (bInCreateNewPackage)
+		MyPackageParams.ReplaceMode = EPackageReplaceMode::CreateNewAssets;
+
 	return MyPackageParams.CreatePackageForObject(OutTextureName);
 }
 
@@ -585,48 +623,58 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	uint8 * MipData = Texture->Source.LockMip(0);
 
 	// Create base map.
-	uint8* DestPtr = nullptr;
-	uint32 SrcWidth = ImageInfo.xRes;
-	uint32 SrcHeight = ImageInfo.yRes;
-	const char * SrcData = &ImageBuffer[0];
-
-	for (uint32 y = 0; y < SrcHeight; y++)
-	{
-		DestPtr = &MipData[(SrcHeight - 1 - y) * SrcWidth * sizeof(FColor)];
-
-		for (uint32 x = 0; x < SrcWidth; x++)
+	// HAPI gives us interleaved RGBA8 rows bottom to top, we need BGRA8 rows top to bottom.
+	// Each pixel is handled as a single 32 bit word so the inner loop can be vectorized,
+	// and rows are converted in parallel. We look for an actual alpha value in the same pass.
+	const int32 SrcWidth = ImageInfo.xRes;
+	const int32 SrcHeight = ImageInfo.yRes;
+	const uint32 * SrcPixels = reinterpret_cast<const uint32*>(ImageBuffer.GetData());
+	uint32 * DestPixels = reinterpret_cast<uint32*>(MipData);
+
+	// If we don't use alpha, force it to opaque
+	const uint32 AlphaMask = TextureParameters.bUseAlpha ? 0x00000000 : 0xFF000000;
+
+	// Convert chunks of rows to limit the task overhead on small textures
+	const int32 RowsPerChunk = FMath::Max(1, 16384 / FMath::Max(1, SrcWidth));
+	const int32 NumChunks = FMath::DivideAndRoundUp(SrcHeight, RowsPerChunk);
+	TArray<uint32> ChunkTransparency;
+	ChunkTransparency.SetNumZeroed(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIdx)
+	{
+		const int32 FirstRow = ChunkIdx * RowsPerChunk;
+		const int32 LastRow = FMath::Min(FirstRow + RowsPerChunk, SrcHeight);
+
+		uint32 Transparency = 0;
+		for (int32 y = FirstRow; y < LastRow; y++)
 		{
-			uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 2); // B
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 1); // G
-			*DestPtr++ = *(uint8*)(SrcData + DataOffset + 0); // R
+			const uint32 * SrcRow = SrcPixels + (int64)y * SrcWidth;
+			uint32 * DestRow = DestPixels + (int64)(SrcHeight - 1 - y) * SrcWidth;
 
-			if (TextureParameters.bUseAlpha)
-				*DestPtr++ = *(uint8*)(SrcData + DataOffset + 3); // A
-			else
-				*DestPtr++ = 0xFF;
+			for (int32 x = 0; x < SrcWidth; x++)
+			{
+				// Little endian: RGBA bytes are read as 0xAABBGGRR, and BGRA as 0xAARRGGBB
+				const uint32 Pixel = SrcRow[x];
+				Transparency |= ~Pixel;
+				DestRow[x] = (Pixel & 0xFF00FF00) | ((Pixel & 0x000000FF) << 16) | ((Pixel >> 16) & 0x000000FF) | AlphaMask;
+			}
 		}
-	}
 
+		// Only keep the alpha bits
+		ChunkTransparency[ChunkIdx] = Transparency & 0xFF000000;
+	});
+
+	// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
 	bool bHasAlphaValue = false;
 	if (TextureParameters.bUseAlpha)
 	{
-		// See if there is an actual alpha value in the texture or if we can ignore the texture alpha
-		for (uint32 y = 0; y < SrcHeight; y++)
+		for (const uint32& CurrentTransparency : ChunkTransparency)
 		{
-			for (uint32 x = 0; x < SrcWidth; x++)
+			if (CurrentTransparency != 0)
 			{
-				uint32 DataOffset = y * SrcWidth * 4 + x * 4;
-				if (*(uint8*)(SrcData + DataOffset + 3) != 0xFF)
-				{
-					bHasAlphaValue = true;
-					break;
-				}
-			}
-
-			if (bHasAlphaValue)
+				bHasAlphaValue = true;
 				break;
+			}
 		}
 	}
 
@@ -647,12 +695,157 @@ FHoudiniMaterialTranslator::CreateUnrealTexture(
 	}
 	*/
 
-	Texture->PostEditChange();
+	// Callers are responsible for calling PostEditChange() once the texture is fully set up,
+	// doing it here as well would build the texture twice.
+
+	return Texture;
+}
+
+
+
+// Generated textures, by content key
+static TMap<uint64, TWeakObjectPtr<UTexture2D>> GeneratedTextureCache;
+// Content key of the cached textures, used to remove their entry when they are regenerated
+static TMap<TWeakObjectPtr<UTexture2D>, uint64> GeneratedTextureCacheKeys;
+// Cached textures that have been reused by materials other than the one that generated them
+static TSet<TWeakObjectPtr<UTexture2D>> SharedGeneratedTextures;
+
+uint64
+FHoudiniMaterialTranslator::GetTextureCacheKey(
+	const HAPI_ImageInfo& ImageInfo,
+	const TArray<char>& ImageBuffer,
+	const FCreateTexture2DParameters& TextureParameters,
+	const TextureGroup& LODGroup,
+	const FString& TextureType)
+{
+	uint64 Key = CityHash64(ImageBuffer.GetData(), ImageBuffer.Num());
+
+	// The texture settings must match as well
+	int32 Settings[6] = 
+	{
+		ImageInfo.xRes, 
+		ImageInfo.yRes, 
+		TextureParameters.bUseAlpha ? 1 : 0,
+		TextureParameters.bSRGB ? 1 : 0,
+		(int32)TextureParameters.CompressionSettings,
+		(int32)LODGroup
+	};
+	Key = CityHash64WithSeed((const char*)&Settings[0], sizeof(Settings), Key);
+	Key = CityHash64WithSeed((const char*)*TextureType, TextureType.Len() * sizeof(TCHAR), Key);
+
+	return Key;
+}
+
+// Returns the package path generated textures are created in for these package params
+static FString
+GetTexturePackagePath(const FHoudiniPackageParams& InPackageParams)
+{
+	FHoudiniPackageParams MyPackageParams = InPackageParams;
+	MyPackageParams.PackageMode = FHoudiniPackageParams::GetDefaultMaterialAndTextureCookMode();
+	return MyPackageParams.GetPackagePath();
+}
+
+UTexture2D*
+FHoudiniMaterialTranslator::FindCachedTexture(
+	const uint64& InKey,
+	const HAPI_NodeId& InAssetId,
+	const HAPI_NodeId& InMaterialNodeId,
+	const FString& InTextureType,
+	const FHoudiniPackageParams& InPackageParams)
+{
+	TWeakObjectPtr<UTexture2D>* FoundTexture = GeneratedTextureCache.Find(InKey);
+	if (!FoundTexture)
+		return nullptr;
+
+	UTexture2D* Texture = FoundTexture->Get();
+	if (!Texture || Texture->IsPendingKill() || !Texture->GetOutermost() || Texture->GetOutermost()->IsPendingKill())
+	{
+		// The texture has been deleted
+		GeneratedTextureCache.Remove(InKey);
+		return nullptr;
+	}
+
+	// Don't share textures across HDAs, they could be modified or deleted by their owner
+	if (FPackageName::GetLongPackagePath(Texture->GetOutermost()->GetName()) != GetTexturePackagePath(InPackageParams))
+		return nullptr;
+
+	// Its owner must not update it in place anymore
+	if (!IsTextureOwnedByMaterial(Texture, InAssetId, InMaterialNodeId, InTextureType, InPackageParams))
+		SharedGeneratedTextures.Add(Texture);
 
 	return Texture;
 }
 
+bool
+FHoudiniMaterialTranslator::IsTextureOwnedByMaterial(
+	UTexture2D* InTexture,
+	const HAPI_NodeId& InAssetId,
+	const HAPI_NodeId& InMaterialNodeId,
+	const FString& InTextureType,
+	const FHoudiniPackageParams& InPackageParams)
+{
+	if (!InTexture || InTexture->IsPendingKill())
+		return false;
+
+	// The texture must be the only asset of its own package
+	UPackage* Package = Cast<UPackage>(InTexture->GetOuter());
+	if (!Package || Package->IsPendingKill())
+		return false;
+
+	if (FPackageName::GetLongPackagePath(Package->GetName()) != GetTexturePackagePath(InPackageParams))
+		return false;
 
+	UMetaData* MetaData = Package->GetMetaData();
+	if (!MetaData)
+		return false;
+
+	if (MetaData->GetValue(InTexture, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_TYPE) != InTextureType)
+		return false;
+
+	FString NodePath;
+	if (!FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialNodeId, NodePath))
+		return false;
+
+	return MetaData->GetValue(InTexture, HAPI_UNREAL_PACKAGE_META_NODE_PATH) == NodePath;
+}
+
+bool
+FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+	UTexture2D* InTexture,
+	const HAPI_NodeId& InAssetId,
+	const HAPI_NodeId& InMaterialNodeId,
+	const FString& InTextureType,
+	const FHoudiniPackageParams& InPackageParams)
+{
+	if (SharedGeneratedTextures.Contains(InTexture))
+		return false;
+
+	return IsTextureOwnedByMaterial(InTexture, InAssetId, InMaterialNodeId, InTextureType, InPackageParams);
+}
+
+void
+FHoudiniMaterialTranslator::AddTextureToCache(const uint64& InKey, UTexture2D* InTexture)
+{
+	if (!InTexture || InTexture->IsPendingKill())
+		return;
+
+	// If the texture was cached with a different content, its previous entry is not valid anymore
+	TWeakObjectPtr<UTexture2D> WeakTexture(InTexture);
+	uint64* PreviousKey = GeneratedTextureCacheKeys.Find(WeakTexture);
+	if (PreviousKey && *PreviousKey != InKey)
+		GeneratedTextureCache.Remove(*PreviousKey);
+
+	GeneratedTextureCache.Add(InKey, WeakTexture);
+	GeneratedTextureCacheKeys.Add(WeakTexture, InKey);
+}
+
+void
+FHoudiniMaterialTranslator::ClearTextureCache()
+{
+	GeneratedTextureCache.Empty();
+	GeneratedTextureCacheKeys.Empty();
+	SharedGeneratedTextures.Empty();
+}
 
 bool
 FHoudiniMaterialTranslator::HapiExtractImage(
@@ -970,43 +1163,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				FString TextureDiffuseName;
 				bool bCreatedNewTextureDiffuse = false;
 
-				// Create diffuse texture package, if this is a new diffuse texture.
-				if (!TextureDiffusePackage)
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureDiffuseCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE);
+				UTexture2D * CachedTextureDiffuse = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureDiffuseCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE, InPackageParams);
+				if (CachedTextureDiffuse)
 				{
-					TextureDiffusePackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-						InPackageParams,
-						TextureDiffuseName);
-				}
-				else if (TextureDiffuse && !TextureDiffuse->IsPendingKill())
-				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureDiffuseName = TextureDiffuse->GetName();
+					TextureDiffuse = CachedTextureDiffuse;
+					TextureDiffusePackage = CachedTextureDiffuse->GetOutermost();
 				}
 				else
 				{
-					TextureDiffuseName = FPaths::GetBaseFilename(TextureDiffusePackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureDiffuse = false;
+					if (TextureDiffuse && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureDiffuse, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE, InPackageParams))
+					{
+						bCopyTextureDiffuse = true;
+						TextureDiffuse = nullptr;
+						TextureDiffusePackage = nullptr;
+					}
 
-				// Create diffuse texture, if we need to create one.
-				if (!TextureDiffuse || TextureDiffuse->IsPendingKill())
-					bCreatedNewTextureDiffuse = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing diffuse texture, or create new one.
-				TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureDiffuse,
-					ImageInfo,
-					TextureDiffusePackage,
-					TextureDiffuseName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
-					NodePath);
+					// Create diffuse texture package, if this is a new diffuse texture.
+					if (!TextureDiffusePackage)
+					{
+						TextureDiffusePackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
+							InPackageParams,
+							TextureDiffuseName,
+							bCopyTextureDiffuse);
+					}
+					else if (TextureDiffuse && !TextureDiffuse->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureDiffuseName = TextureDiffuse->GetName();
+					}
+					else
+					{
+						TextureDiffuseName = FPaths::GetBaseFilename(TextureDiffusePackage->GetName(), true);
+					}
+
+					// Create diffuse texture, if we need to create one.
+					if (!TextureDiffuse || TextureDiffuse->IsPendingKill())
+						bCreatedNewTextureDiffuse = true;
+
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing diffuse texture, or create new one.
+					TextureDiffuse = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureDiffuse,
+						ImageInfo,
+						TextureDiffusePackage,
+						TextureDiffuseName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_DIFFUSE,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureDiffuseCacheKey, TextureDiffuse);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureDiffuse->SetFlags(RF_Public | RF_Standalone);
@@ -1027,13 +1247,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentDiffuse(
 				// Add expression.
 				Material->Expressions.Add(ExpressionTextureSample);
 
-				// Propagate and trigger diffuse texture updates.
-				if (bCreatedNewTextureDiffuse)
-					FAssetRegistryModule::AssetCreated(TextureDiffuse);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureDiffuse)
+				{
+					if (bCreatedNewTextureDiffuse)
+						FAssetRegistryModule::AssetCreated(TextureDiffuse);
 
-				TextureDiffuse->PreEditChange(nullptr);
-				TextureDiffuse->PostEditChange();
-				TextureDiffuse->MarkPackageDirty();
+					TextureDiffuse->PreEditChange(nullptr);
+					TextureDiffuse->PostEditChange();
+					TextureDiffuse->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1249,43 +1472,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				FString TextureOpacityName;
 				bool bCreatedNewTextureOpacity = false;
 
-				// Create opacity texture package, if this is a new opacity texture.
-				if (!TextureOpacityPackage)
-				{
-					TextureOpacityPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-						InPackageParams,
-						TextureOpacityName);
-				}
-				else if (TextureOpacity && !TextureOpacity->IsPendingKill())
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureOpacityCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK);
+				UTexture2D * CachedTextureOpacity = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureOpacityCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK, InPackageParams);
+				if (CachedTextureOpacity)
 				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureOpacityName = TextureOpacity->GetName();
+					TextureOpacity = CachedTextureOpacity;
+					TextureOpacityPackage = CachedTextureOpacity->GetOutermost();
 				}
 				else
 				{
-					TextureOpacityName = FPaths::GetBaseFilename(TextureOpacityPackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureOpacity = false;
+					if (TextureOpacity && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureOpacity, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK, InPackageParams))
+					{
+						bCopyTextureOpacity = true;
+						TextureOpacity = nullptr;
+						TextureOpacityPackage = nullptr;
+					}
+
+					// Create opacity texture package, if this is a new opacity texture.
+					if (!TextureOpacityPackage)
+					{
+						TextureOpacityPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
+							InPackageParams,
+							TextureOpacityName,
+							bCopyTextureOpacity);
+					}
+					else if (TextureOpacity && !TextureOpacity->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureOpacityName = TextureOpacity->GetName();
+					}
+					else
+					{
+						TextureOpacityName = FPaths::GetBaseFilename(TextureOpacityPackage->GetName(), true);
+					}
+
+					// Create opacity texture, if we need to create one.
+					if (!TextureOpacity)
+						bCreatedNewTextureOpacity = true;
 
-				// Create opacity texture, if we need to create one.
-				if (!TextureOpacity)
-					bCreatedNewTextureOpacity = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing opacity texture, or create new one.
-				TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureOpacity,
-					ImageInfo,
-					TextureOpacityPackage, 
-					TextureOpacityName, 
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
-					NodePath);
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing opacity texture, or create new one.
+					TextureOpacity = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureOpacity,
+						ImageInfo,
+						TextureOpacityPackage, 
+						TextureOpacityName, 
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_OPACITY_MASK,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureOpacityCacheKey, TextureOpacity);
+				}
 
  				// if (BakeMode == EBakeMode::CookToTemp)
 				TextureOpacity->SetFlags(RF_Public | RF_Standalone);
@@ -1325,13 +1575,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentOpacityMask(
 				Material->OpacityMask.MaskB = 0;
 				Material->OpacityMask.MaskA = 0;
 
-				// Propagate and trigger opacity texture updates.
-				if (bCreatedNewTextureOpacity)
-					FAssetRegistryModule::AssetCreated(TextureOpacity);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureOpacity)
+				{
+					if (bCreatedNewTextureOpacity)
+						FAssetRegistryModule::AssetCreated(TextureOpacity);
 
-				TextureOpacity->PreEditChange(nullptr);
-				TextureOpacity->PostEditChange();
-				TextureOpacity->MarkPackageDirty();
+					TextureOpacity->PreEditChange(nullptr);
+					TextureOpacity->PostEditChange();
+					TextureOpacity->MarkPackageDirty();
+				}
 
 				bExpressionCreated = true;
 			}
@@ -1659,43 +1912,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 				FString TextureNormalName;
 				bool bCreatedNewTextureNormal = false;
 
-				// Create normal texture package, if this is a new normal texture.
-				if (!TextureNormalPackage)
-				{
-					TextureNormalPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						InPackageParams,
-						TextureNormalName);
-				}
-				else if (TextureNormal && !TextureNormal->IsPendingKill())
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureNormalCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_WorldNormalMap, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL);
+				UTexture2D * CachedTextureNormal = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureNormalCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams);
+				if (CachedTextureNormal)
 				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureNormalName = TextureNormal->GetName();
+					TextureNormal = CachedTextureNormal;
+					TextureNormalPackage = CachedTextureNormal->GetOutermost();
 				}
 				else
 				{
-					TextureNormalName = FPaths::GetBaseFilename(TextureNormalPackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureNormal = false;
+					if (TextureNormal && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureNormal, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams))
+					{
+						bCopyTextureNormal = true;
+						TextureNormal = nullptr;
+						TextureNormalPackage = nullptr;
+					}
+
+					// Create normal texture package, if this is a new normal texture.
+					if (!TextureNormalPackage)
+					{
+						TextureNormalPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+							InPackageParams,
+							TextureNormalName,
+							bCopyTextureNormal);
+					}
+					else if (TextureNormal && !TextureNormal->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureNormalName = TextureNormal->GetName();
+					}
+					else
+					{
+						TextureNormalName = FPaths::GetBaseFilename(TextureNormalPackage->GetName(), true);
+					}
+
+					// Create normal texture, if we need to create one.
+					if (!TextureNormal)
+						bCreatedNewTextureNormal = true;
 
-				// Create normal texture, if we need to create one.
-				if (!TextureNormal)
-					bCreatedNewTextureNormal = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing normal texture, or create new one.
-				TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureNormal,
-					ImageInfo,
-					TextureNormalPackage,
-					TextureNormalName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_WorldNormalMap,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-					NodePath);
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing normal texture, or create new one.
+					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureNormal,
+						ImageInfo,
+						TextureNormalPackage,
+						TextureNormalName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_WorldNormalMap,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureNormalCacheKey, TextureNormal);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -1726,13 +2006,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 
 				bExpressionCreated = true;
 
-				// Propagate and trigger normal texture updates.
-				if (bCreatedNewTextureNormal)
-					FAssetRegistryModule::AssetCreated(TextureNormal);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureNormal)
+				{
+					if (bCreatedNewTextureNormal)
+						FAssetRegistryModule::AssetCreated(TextureNormal);
 
-				TextureNormal->PreEditChange(nullptr);
-				TextureNormal->PostEditChange();
-				TextureNormal->MarkPackageDirty();
+					TextureNormal->PreEditChange(nullptr);
+					TextureNormal->PostEditChange();
+					TextureNormal->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -1805,43 +2088,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					FString TextureNormalName;
 					bool bCreatedNewTextureNormal = false;
 
-					// Create normal texture package, if this is a new normal texture.
-					if (!TextureNormalPackage)
+					// Reuse an identical texture if one has already been generated
+					const uint64 TextureNormalCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+						ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_WorldNormalMap, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL);
+					UTexture2D * CachedTextureNormal = FHoudiniMaterialTranslator::FindCachedTexture(
+						TextureNormalCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams);
+					if (CachedTextureNormal)
 					{
-						TextureNormalPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-							InMaterialInfo.nodeId,
-							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-							InPackageParams,
-							TextureNormalName);
-					}
-					else if (TextureNormal && !TextureNormal->IsPendingKill())
-					{
-						// Get the name of the texture if we are overwriting the exist asset
-						TextureNormalName = TextureNormal->GetName();
+						TextureNormal = CachedTextureNormal;
+						TextureNormalPackage = CachedTextureNormal->GetOutermost();
 					}
 					else
 					{
-						TextureNormalName = FPaths::GetBaseFilename(TextureNormalPackage->GetName(), true);
-					}
-
-					// Create normal texture, if we need to create one.
-					if (!TextureNormal)
-						bCreatedNewTextureNormal = true;
-
-					FString NodePath;
-					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+						// Never overwrite a texture that was generated for another material, or that other materials
+						// are using: create our own, in a new package, instead
+						bool bCopyTextureNormal = false;
+						if (TextureNormal && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+							TextureNormal, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL, InPackageParams))
+						{
+							bCopyTextureNormal = true;
+							TextureNormal = nullptr;
+							TextureNormalPackage = nullptr;
+						}
+
+						// Create normal texture package, if this is a new normal texture.
+						if (!TextureNormalPackage)
+						{
+							TextureNormalPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+								InMaterialInfo.nodeId,
+								HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+								InPackageParams,
+								TextureNormalName,
+								bCopyTextureNormal);
+						}
+						else if (TextureNormal && !TextureNormal->IsPendingKill())
+						{
+							// Get the name of the texture if we are overwriting the exist asset
+							TextureNormalName = TextureNormal->GetName();
+						}
+						else
+						{
+							TextureNormalName = FPaths::GetBaseFilename(TextureNormalPackage->GetName(), true);
+						}
+
+						// Create normal texture, if we need to create one.
+						if (!TextureNormal)
+							bCreatedNewTextureNormal = true;
+
+						FString NodePath;
+						FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+						// Reuse existing normal texture, or create new one.
+						TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
+							TextureNormal, 
+							ImageInfo,
+							TextureNormalPackage, 
+							TextureNormalName,
+							ImageBuffer,
+							CreateTexture2DParameters,
+							TEXTUREGROUP_WorldNormalMap,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
+							NodePath);
 
-					// Reuse existing normal texture, or create new one.
-					TextureNormal = FHoudiniMaterialTranslator::CreateUnrealTexture(
-						TextureNormal, 
-						ImageInfo,
-						TextureNormalPackage, 
-						TextureNormalName,
-						ImageBuffer,
-						CreateTexture2DParameters,
-						TEXTUREGROUP_WorldNormalMap,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_NORMAL,
-						NodePath);
+						FHoudiniMaterialTranslator::AddTextureToCache(TextureNormalCacheKey, TextureNormal);
+					}
 
 					//if (BakeMode == EBakeMode::CookToTemp)
 					TextureNormal->SetFlags(RF_Public | RF_Standalone);
@@ -1870,13 +2180,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentNormal(
 					Material->Expressions.Add(ExpressionNormal);
 					Material->Normal.Expression = ExpressionNormal;
 
-					// Propagate and trigger diffuse texture updates.
-					if (bCreatedNewTextureNormal)
-						FAssetRegistryModule::AssetCreated(TextureNormal);
+					// Propagate and trigger texture updates, a cached texture is already up to date.
+					if (!CachedTextureNormal)
+					{
+						if (bCreatedNewTextureNormal)
+							FAssetRegistryModule::AssetCreated(TextureNormal);
 
-					TextureNormal->PreEditChange(nullptr);
-					TextureNormal->PostEditChange();
-					TextureNormal->MarkPackageDirty();
+						TextureNormal->PreEditChange(nullptr);
+						TextureNormal->PostEditChange();
+						TextureNormal->MarkPackageDirty();
+					}
 
 					bExpressionCreated = true;
 				}
@@ -1981,43 +2294,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 				FString TextureSpecularName;
 				bool bCreatedNewTextureSpecular = false;
 
-				// Create specular texture package, if this is a new specular texture.
-				if (!TextureSpecularPackage)
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureSpecularCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR);
+				UTexture2D * CachedTextureSpecular = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureSpecularCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR, InPackageParams);
+				if (CachedTextureSpecular)
 				{
-					TextureSpecularPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-						InPackageParams,
-						TextureSpecularName);
-				}
-				else if (TextureSpecular && !TextureSpecular->IsPendingKill())
-				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureSpecularName = TextureSpecular->GetName();
+					TextureSpecular = CachedTextureSpecular;
+					TextureSpecularPackage = CachedTextureSpecular->GetOutermost();
 				}
 				else
 				{
-					TextureSpecularName = FPaths::GetBaseFilename(TextureSpecularPackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureSpecular = false;
+					if (TextureSpecular && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureSpecular, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR, InPackageParams))
+					{
+						bCopyTextureSpecular = true;
+						TextureSpecular = nullptr;
+						TextureSpecularPackage = nullptr;
+					}
+
+					// Create specular texture package, if this is a new specular texture.
+					if (!TextureSpecularPackage)
+					{
+						TextureSpecularPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
+							InPackageParams,
+							TextureSpecularName,
+							bCopyTextureSpecular);
+					}
+					else if (TextureSpecular && !TextureSpecular->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureSpecularName = TextureSpecular->GetName();
+					}
+					else
+					{
+						TextureSpecularName = FPaths::GetBaseFilename(TextureSpecularPackage->GetName(), true);
+					}
+
+					// Create specular texture, if we need to create one.
+					if (!TextureSpecular)
+						bCreatedNewTextureSpecular = true;
+
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing specular texture, or create new one.
+					TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureSpecular,
+						ImageInfo,
+						TextureSpecularPackage,
+						TextureSpecularName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
+						NodePath);
 
-				// Create specular texture, if we need to create one.
-				if (!TextureSpecular)
-					bCreatedNewTextureSpecular = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing specular texture, or create new one.
-				TextureSpecular = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureSpecular,
-					ImageInfo,
-					TextureSpecularPackage,
-					TextureSpecularName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_SPECULAR,
-					NodePath);
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureSpecularCacheKey, TextureSpecular);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureSpecular->SetFlags(RF_Public | RF_Standalone);
@@ -2047,13 +2387,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentSpecular(
 
 				bExpressionCreated = true;
 
-				// Propagate and trigger specular texture updates.
-				if (bCreatedNewTextureSpecular)
-					FAssetRegistryModule::AssetCreated(TextureSpecular);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureSpecular)
+				{
+					if (bCreatedNewTextureSpecular)
+						FAssetRegistryModule::AssetCreated(TextureSpecular);
 
-				TextureSpecular->PreEditChange(nullptr);
-				TextureSpecular->PostEditChange();
-				TextureSpecular->MarkPackageDirty();
+					TextureSpecular->PreEditChange(nullptr);
+					TextureSpecular->PostEditChange();
+					TextureSpecular->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2222,43 +2565,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 				FString TextureRoughnessName;
 				bool bCreatedNewTextureRoughness = false;
 
-				// Create roughness texture package, if this is a new roughness texture.
-				if (!TextureRoughnessPackage)
-				{
-					TextureRoughnessPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-						InPackageParams,
-						TextureRoughnessName);
-				}
-				else if (TextureRoughness && !TextureRoughness->IsPendingKill())
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureRoughnessCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS);
+				UTexture2D * CachedTextureRoughness = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureRoughnessCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS, InPackageParams);
+				if (CachedTextureRoughness)
 				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureRoughnessName = TextureRoughness->GetName();
+					TextureRoughness = CachedTextureRoughness;
+					TextureRoughnessPackage = CachedTextureRoughness->GetOutermost();
 				}
 				else
 				{
-					TextureRoughnessName = FPaths::GetBaseFilename(TextureRoughnessPackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureRoughness = false;
+					if (TextureRoughness && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureRoughness, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS, InPackageParams))
+					{
+						bCopyTextureRoughness = true;
+						TextureRoughness = nullptr;
+						TextureRoughnessPackage = nullptr;
+					}
+
+					// Create roughness texture package, if this is a new roughness texture.
+					if (!TextureRoughnessPackage)
+					{
+						TextureRoughnessPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
+							InPackageParams,
+							TextureRoughnessName,
+							bCopyTextureRoughness);
+					}
+					else if (TextureRoughness && !TextureRoughness->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureRoughnessName = TextureRoughness->GetName();
+					}
+					else
+					{
+						TextureRoughnessName = FPaths::GetBaseFilename(TextureRoughnessPackage->GetName(), true);
+					}
+
+					// Create roughness texture, if we need to create one.
+					if (!TextureRoughness)
+						bCreatedNewTextureRoughness = true;
+
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
 
-				// Create roughness texture, if we need to create one.
-				if (!TextureRoughness)
-					bCreatedNewTextureRoughness = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing roughness texture, or create new one.
-				TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureRoughness,
-					ImageInfo,
-					TextureRoughnessPackage,
-					TextureRoughnessName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
-					NodePath);
+					// Reuse existing roughness texture, or create new one.
+					TextureRoughness = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureRoughness,
+						ImageInfo,
+						TextureRoughnessPackage,
+						TextureRoughnessName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_ROUGHNESS,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureRoughnessCacheKey, TextureRoughness);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureRoughness->SetFlags(RF_Public | RF_Standalone);
@@ -2286,13 +2656,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentRoughness(
 
 				bExpressionCreated = true;
 
-				// Propagate and trigger roughness texture updates.
-				if (bCreatedNewTextureRoughness)
-					FAssetRegistryModule::AssetCreated(TextureRoughness);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureRoughness)
+				{
+					if (bCreatedNewTextureRoughness)
+						FAssetRegistryModule::AssetCreated(TextureRoughness);
 
-				TextureRoughness->PreEditChange(nullptr);
-				TextureRoughness->PostEditChange();
-				TextureRoughness->MarkPackageDirty();
+					TextureRoughness->PreEditChange(nullptr);
+					TextureRoughness->PostEditChange();
+					TextureRoughness->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2455,44 +2828,71 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 				FString TextureMetallicName;
 				bool bCreatedNewTextureMetallic = false;
 
-				// Create metallic texture package, if this is a new metallic texture.
-				if (!TextureMetallicPackage)
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureMetallicCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC);
+				UTexture2D * CachedTextureMetallic = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureMetallicCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC, InPackageParams);
+				if (CachedTextureMetallic)
 				{
-					TextureMetallicPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-						InPackageParams,
-						TextureMetallicName);
-				}
-				else if (TextureMetallic && !TextureMetallic->IsPendingKill())
-				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureMetallicName = TextureMetallic->GetName();
+					TextureMetallic = CachedTextureMetallic;
+					TextureMetallicPackage = CachedTextureMetallic->GetOutermost();
 				}
 				else
 				{
-					TextureMetallicName = FPaths::GetBaseFilename(TextureMetallicPackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureMetallic = false;
+					if (TextureMetallic && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureMetallic, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC, InPackageParams))
+					{
+						bCopyTextureMetallic = true;
+						TextureMetallic = nullptr;
+						TextureMetallicPackage = nullptr;
+					}
 
-				// Create metallic texture, if we need to create one.
-				if (!TextureMetallic)
-					bCreatedNewTextureMetallic = true;
-
-				// Get the node path to add it to the meta data
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing metallic texture, or create new one.
-				TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureMetallic, 
-					ImageInfo,
-					TextureMetallicPackage,
-					TextureMetallicName,
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
-					NodePath);
+					// Create metallic texture package, if this is a new metallic texture.
+					if (!TextureMetallicPackage)
+					{
+						TextureMetallicPackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
+							InPackageParams,
+							TextureMetallicName,
+							bCopyTextureMetallic);
+					}
+					else if (TextureMetallic && !TextureMetallic->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureMetallicName = TextureMetallic->GetName();
+					}
+					else
+					{
+						TextureMetallicName = FPaths::GetBaseFilename(TextureMetallicPackage->GetName(), true);
+					}
+
+					// Create metallic texture, if we need to create one.
+					if (!TextureMetallic)
+						bCreatedNewTextureMetallic = true;
+
+					// Get the node path to add it to the meta data
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing metallic texture, or create new one.
+					TextureMetallic = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureMetallic, 
+						ImageInfo,
+						TextureMetallicPackage,
+						TextureMetallicName,
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_METALLIC,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureMetallicCacheKey, TextureMetallic);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureMetallic->SetFlags(RF_Public | RF_Standalone);
@@ -2520,13 +2920,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentMetallic(
 
 				bExpressionCreated = true;
 
-				// Propagate and trigger metallic texture updates.
-				if (bCreatedNewTextureMetallic)
-					FAssetRegistryModule::AssetCreated(TextureMetallic);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureMetallic)
+				{
+					if (bCreatedNewTextureMetallic)
+						FAssetRegistryModule::AssetCreated(TextureMetallic);
 
-				TextureMetallic->PreEditChange(nullptr);
-				TextureMetallic->PostEditChange();
-				TextureMetallic->MarkPackageDirty();
+					TextureMetallic->PreEditChange(nullptr);
+					TextureMetallic->PostEditChange();
+					TextureMetallic->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2679,43 +3082,70 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 				FString TextureEmissiveName;
 				bool bCreatedNewTextureEmissive = false;
 
-				// Create emissive texture package, if this is a new emissive texture.
-				if (!TextureEmissivePackage)
-				{
-					TextureEmissivePackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
-						InMaterialInfo.nodeId,
-						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-						InPackageParams,
-						TextureEmissiveName);
-				}
-				else if (TextureEmissive && !TextureEmissive->IsPendingKill())
+				// Reuse an identical texture if one has already been generated
+				const uint64 TextureEmissiveCacheKey = FHoudiniMaterialTranslator::GetTextureCacheKey(
+					ImageInfo, ImageBuffer, CreateTexture2DParameters, TEXTUREGROUP_World, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE);
+				UTexture2D * CachedTextureEmissive = FHoudiniMaterialTranslator::FindCachedTexture(
+					TextureEmissiveCacheKey, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE, InPackageParams);
+				if (CachedTextureEmissive)
 				{
-					// Get the name of the texture if we are overwriting the exist asset
-					TextureEmissiveName = TextureEmissive->GetName();
+					TextureEmissive = CachedTextureEmissive;
+					TextureEmissivePackage = CachedTextureEmissive->GetOutermost();
 				}
 				else
 				{
-					TextureEmissiveName = FPaths::GetBaseFilename(TextureEmissivePackage->GetName(), true);
-				}
+					// Never overwrite a texture that was generated for another material, or that other materials
+					// are using: create our own, in a new package, instead
+					bool bCopyTextureEmissive = false;
+					if (TextureEmissive && !FHoudiniMaterialTranslator::CanUpdateTextureInPlace(
+						TextureEmissive, InAssetId, InMaterialInfo.nodeId, HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE, InPackageParams))
+					{
+						bCopyTextureEmissive = true;
+						TextureEmissive = nullptr;
+						TextureEmissivePackage = nullptr;
+					}
 
-				// Create emissive texture, if we need to create one.
-				if (!TextureEmissive)
-					bCreatedNewTextureEmissive = true;
-
-				FString NodePath;
-				FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
-
-				// Reuse existing emissive texture, or create new one.
-				TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
-					TextureEmissive,
-					ImageInfo,
-					TextureEmissivePackage,
-					TextureEmissiveName, 
-					ImageBuffer,
-					CreateTexture2DParameters,
-					TEXTUREGROUP_World,
-					HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
-					NodePath);
+					// Create emissive texture package, if this is a new emissive texture.
+					if (!TextureEmissivePackage)
+					{
+						TextureEmissivePackage = FHoudiniMaterialTranslator::CreatePackageForTexture(
+							InMaterialInfo.nodeId,
+							HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
+							InPackageParams,
+							TextureEmissiveName,
+							bCopyTextureEmissive);
+					}
+					else if (TextureEmissive && !TextureEmissive->IsPendingKill())
+					{
+						// Get the name of the texture if we are overwriting the exist asset
+						TextureEmissiveName = TextureEmissive->GetName();
+					}
+					else
+					{
+						TextureEmissiveName = FPaths::GetBaseFilename(TextureEmissivePackage->GetName(), true);
+					}
+
+					// Create emissive texture, if we need to create one.
+					if (!TextureEmissive)
+						bCreatedNewTextureEmissive = true;
+
+					FString NodePath;
+					FHoudiniMaterialTranslator::GetMaterialRelativePath(InAssetId, InMaterialInfo.nodeId, NodePath);
+
+					// Reuse existing emissive texture, or create new one.
+					TextureEmissive = FHoudiniMaterialTranslator::CreateUnrealTexture(
+						TextureEmissive,
+						ImageInfo,
+						TextureEmissivePackage,
+						TextureEmissiveName, 
+						ImageBuffer,
+						CreateTexture2DParameters,
+						TEXTUREGROUP_World,
+						HAPI_UNREAL_PACKAGE_META_GENERATED_TEXTURE_EMISSIVE,
+						NodePath);
+
+					FHoudiniMaterialTranslator::AddTextureToCache(TextureEmissiveCacheKey, TextureEmissive);
+				}
 
 				//if (BakeMode == EBakeMode::CookToTemp)
 				TextureEmissive->SetFlags(RF_Public | RF_Standalone);
@@ -2743,13 +3173,16 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 
 				bExpressionCreated = true;
 
-				// Propagate and trigger metallic texture updates.
-				if (bCreatedNewTextureEmissive)
-					FAssetRegistryModule::AssetCreated(TextureEmissive);
+				// Propagate and trigger texture updates, a cached texture is already up to date.
+				if (!CachedTextureEmissive)
+				{
+					if (bCreatedNewTextureEmissive)
+						FAssetRegistryModule::AssetCreated(TextureEmissive);
 
-				TextureEmissive->PreEditChange(nullptr);
-				TextureEmissive->PostEditChange();
-				TextureEmissive->MarkPackageDirty();
+					TextureEmissive->PreEditChange(nullptr);
+					TextureEmissive->PostEditChange();
+					TextureEmissive->MarkPackageDirty();
+				}
 			}
 
 			// Cache the texture package
@@ -2827,11 +3260,58 @@ FHoudiniMaterialTranslator::CreateMaterialComponentEmissive(
 }
 
 
+bool
+FHoudiniMaterialTranslator::IsMaterialCompiling(UMaterialInterface* InMaterial)
+{
+	if (!InMaterial || InMaterial->IsPendingKill())
+		return false;
+
+	UMaterial* Material = InMaterial->GetMaterial();
+	if (!Material || Material->IsPendingKill())
+		return false;
+
+	FMaterialResource* MaterialResource = Material->GetMaterialResource(GMaxRHIFeatureLevel);
+	if (!MaterialResource)
+		return false;
+
+	return !MaterialResource->IsCompilationFinished();
+}
+
+uint32
+FHoudiniMaterialTranslator::GetMaterialInstanceParametersHash(
+	const FString& InSourceMaterial,
+	const TArray<FHoudiniGenericAttribute>& InMaterialParameters,
+	const TArray<UPackage*>& InPackages)
+{
+	uint32 Hash = FCrc::StrCrc32(*InSourceMaterial);
+	for (const FHoudiniGenericAttribute& CurrentParam : InMaterialParameters)
+	{
+		Hash = FCrc::StrCrc32(*CurrentParam.AttributeName, Hash);
+
+		int32 Layout[3] = { (int32)CurrentParam.AttributeType, CurrentParam.AttributeCount, CurrentParam.AttributeTupleSize };
+		Hash = FCrc::MemCrc32(&Layout[0], sizeof(Layout), Hash);
+		Hash = FCrc::MemCrc32(CurrentParam.DoubleValues.GetData(), CurrentParam.DoubleValues.Num() * sizeof(double), Hash);
+		Hash = FCrc::MemCrc32(CurrentParam.IntValues.GetData(), CurrentParam.IntValues.Num() * sizeof(int64), Hash);
+		for (const FString& CurrentString : CurrentParam.StringValues)
+			Hash = FCrc::StrCrc32(*CurrentString, Hash);
+	}
+
+	// Texture parameters can be resolved to the generated textures, so these have to match too
+	for (const UPackage* CurrentPackage : InPackages)
+	{
+		if (CurrentPackage && !CurrentPackage->IsPendingKill())
+			Hash = FCrc::StrCrc32(*CurrentPackage->GetName(), Hash);
+	}
+
+	return Hash;
+}
+
 bool
 FHoudiniMaterialTranslator::UpdateMaterialInstanceParameter(
 	FHoudiniGenericAttribute MaterialParameter,
 	UMaterialInstanceConstant* MaterialInstance,
-	const TArray<UPackage*>& InPackages)
+	const TArray<UPackage*>& InPackages,
+	FStaticParameterSet* InOutStaticParameters)
 {
 	bool bParameterUpdated = false;
 
@@ -3066,9 +3546,11 @@ FHoudiniMaterialTranslator::UpdateMaterialInstanceParameter(
 			bool NewBoolValue = MaterialParameter.GetBoolValue();
 
 			// We need to iterate over the material's static parameter set
-			FStaticParameterSet StaticParameters;
-			MaterialInstance->GetStaticParameterValues(StaticParameters);
+			FStaticParameterSet LocalStaticParameters;
+			if (!InOutStaticParameters)
+				MaterialInstance->GetStaticParameterValues(LocalStaticParameters);
 
+			FStaticParameterSet& StaticParameters = InOutStaticParameters ? *InOutStaticParameters : LocalStaticParameters;
 			for (int32 SwitchParameterIdx = 0; SwitchParameterIdx < StaticParameters.StaticSwitchParameters.Num(); ++SwitchParameterIdx)
 			{
 				FStaticSwitchParameter& SwitchParameter = StaticParameters.StaticSwitchParameters[SwitchParameterIdx];
@@ -3081,7 +3563,10 @@ FHoudiniMaterialTranslator::UpdateMaterialInstanceParameter(
 				SwitchParameter.Value = NewBoolValue;
 				SwitchParameter.bOverride = true;
 
-				MaterialInstance->UpdateStaticPermutation(StaticParameters);
+				// When accumulating, the caller updates the static permutation once all the switches are set
+				if (!InOutStaticParameters)
+					MaterialInstance->UpdateStaticPermutation(StaticParameters);
+
 				bParameterUpdated = true;
 				break;
 			}
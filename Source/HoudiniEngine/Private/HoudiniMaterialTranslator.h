@@ -41,6 +41,7 @@ class UMaterialInstanceConstant;
 class UTexture2D;
 class UTexture;
 class UPackage;
+class FStaticParameterSet;
 
 struct FHoudiniPackageParams;
 struct FCreateTexture2DParameters;
@@ -76,11 +77,23 @@ public:
 		const bool& bForceRecookAll);
 
 	//
+	// If InOutStaticParameters is provided, static switch changes are accumulated in it
+	// instead of updating the instance's static permutation immediately.
 	static bool UpdateMaterialInstanceParameter(
 		FHoudiniGenericAttribute MaterialParameter,
 		UMaterialInstanceConstant* MaterialInstance,
+		const TArray<UPackage*>& InPackages,
+		FStaticParameterSet* InOutStaticParameters = nullptr);
+
+	// Hash of the parameter attributes applied to a material instance
+	static uint32 GetMaterialInstanceParametersHash(
+		const FString& InSourceMaterial,
+		const TArray<FHoudiniGenericAttribute>& InMaterialParameters,
 		const TArray<UPackage*>& InPackages);
 
+	// Returns true if the material's shaders for the current feature level are still being compiled
+	static bool IsMaterialCompiling(UMaterialInterface* InMaterial);
+
 	static UTexture* FindGeneratedTexture(
 		const FString& TextureString,
 		const TArray<UPackage*>& InPackages);
@@ -90,7 +103,8 @@ public:
 		const HAPI_NodeId& InMaterialNodeId,
 		const FString& InTextureType,
 		const FHoudiniPackageParams& InPackageParams,
-		FString& OutTextureName);
+		FString& OutTextureName,
+		const bool& bInCreateNewPackage = false);
 
 	//
 	static UPackage* CreatePackageForMaterial(
@@ -112,6 +126,49 @@ public:
 		const FString& TextureType,
 		const FString& NodePath);
 
+	// Texture cache: textures generated from the same image and settings are shared across materials and cooks.
+	// Returns the key identifying a texture by its content and settings.
+	static uint64 GetTextureCacheKey(
+		const HAPI_ImageInfo& ImageInfo,
+		const TArray<char>& ImageBuffer,
+		const FCreateTexture2DParameters& TextureParameters,
+		const TextureGroup& LODGroup,
+		const FString& TextureType);
+
+	// Returns the texture previously generated for that key, if it's still valid
+	// Only textures generated in the same HDA's package path are shared.
+	// Textures returned to another material than their owner are flagged as shared.
+	static UTexture2D* FindCachedTexture(
+		const uint64& InKey,
+		const HAPI_NodeId& InAssetId,
+		const HAPI_NodeId& InMaterialNodeId,
+		const FString& InTextureType,
+		const FHoudiniPackageParams& InPackageParams);
+
+	// Returns true if the texture has been generated for this material node and texture type,
+	// in the package path of the given package params. Other textures must never be overwritten.
+	static bool IsTextureOwnedByMaterial(
+		UTexture2D* InTexture,
+		const HAPI_NodeId& InAssetId,
+		const HAPI_NodeId& InMaterialNodeId,
+		const FString& InTextureType,
+		const FHoudiniPackageParams& InPackageParams);
+
+	// Returns true if the material can regenerate the texture in place:
+	// it must own it, and the texture must not be shared with other materials (copy on write)
+	static bool CanUpdateTextureInPlace(
+		UTexture2D* InTexture,
+		const HAPI_NodeId& InAssetId,
+		const HAPI_NodeId& InMaterialNodeId,
+		const FString& InTextureType,
+		const FHoudiniPackageParams& InPackageParams);
+
+	// Adds a generated texture to the cache, replacing its previous entry
+	static void AddTextureToCache(const uint64& InKey, UTexture2D* InTexture);
+
+	// Empties the texture cache
+	static void ClearTextureCache();
+
 	// HAPI : Retrieve a list of image planes.
 	static bool HapiExtractImage(
 		const HAPI_ParmId& NodeParmId,
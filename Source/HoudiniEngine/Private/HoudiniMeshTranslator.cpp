@@ -35,6 +35,7 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniMaterialTranslator.h"
+#include "HoudiniObjectPathCache.h"
 #include "HoudiniAssetActor.h"
 
 #include "HoudiniStaticMesh.h"
@@ -84,7 +85,8 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	UObject* InOuterComponent,
 	bool bInTreatExistingMaterialsAsUpToDate,
-	bool bInDestroyProxies)
+	bool bInDestroyProxies,
+	bool bInOnlyUpdateChangedParts)
 {
 	if (!InOutput || InOutput->IsPendingKill())
 		return false;
@@ -108,12 +110,32 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	}
 
 	// Iterate on all of the output's HGPO, creating meshes as we go
-	for (const FHoudiniGeoPartObject& CurHGPO : InOutput->HoudiniGeoPartObjects)
+	const FHoudiniOutputChangeSet& ChangeSet = InOutput->GetChangeSet();
+	for (int32 HGPOIdx = 0; HGPOIdx < InOutput->HoudiniGeoPartObjects.Num(); HGPOIdx++)
 	{
+		const FHoudiniGeoPartObject& CurHGPO = InOutput->HoudiniGeoPartObjects[HGPOIdx];
+
 		// Not a mesh, skip
 		if (CurHGPO.Type != EHoudiniPartType::Mesh)
 			continue;
 
+		// Parts left untouched by the last cook simply keep their existing meshes
+		if (bInOnlyUpdateChangedParts && !InForceRebuild && !ChangeSet.HasHGPOChanged(HGPOIdx))
+		{
+			bool bFoundOldOutputObject = false;
+			for (auto& OldPair : OldOutputObjects)
+			{
+				if (!OldPair.Key.Matches(CurHGPO))
+					continue;
+
+				NewOutputObjects.Add(OldPair.Key, OldPair.Value);
+				bFoundOldOutputObject = true;
+			}
+
+			if (bFoundOldOutputObject)
+				continue;
+		}
+
 		CreateStaticMeshFromHoudiniGeoPartObject(
 			CurHGPO,
 			InPackageParams,
@@ -2148,9 +2170,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_RawMesh()
 					if (!MaterialInterface && !MaterialName.IsEmpty())
 					{
 						// Only try to load a material if has a chance to be valid!
-						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+						MaterialInterface = FHoudiniObjectPathCache::LoadObjectFromPath<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 					}
 
 					if (MaterialInterface)
@@ -3149,9 +3169,7 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 							if (!MaterialName.IsEmpty())
 							{
 								// Only try to load a material if has a chance to be valid!
-								MaterialInterface = Cast< UMaterialInterface >(
-									StaticLoadObject(UMaterialInterface::StaticClass(),
-										nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+								MaterialInterface = FHoudiniObjectPathCache::LoadObjectFromPath<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 							}
 
 							if (MaterialInterface)
@@ -4439,9 +4457,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 					if (!MaterialInterface && !MaterialName.IsEmpty())
 					{
 						// Only try to load a material if has a chance to be valid!
-						MaterialInterface = Cast<UMaterialInterface>(
-							StaticLoadObject(UMaterialInterface::StaticClass(),
-								nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr));
+						MaterialInterface = FHoudiniObjectPathCache::LoadObjectFromPath<UMaterialInterface>(MaterialName, LOAD_NoWarn);
 					}
 
 					if (MaterialInterface)
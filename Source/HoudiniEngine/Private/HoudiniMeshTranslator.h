@@ -85,7 +85,8 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			UObject* InOuterComponent,
 			bool bInTreatExistingMaterialsAsUpToDate=false,
-			bool bInDestroyProxies=false);
+			bool bInDestroyProxies=false,
+			bool bInOnlyUpdateChangedParts=false);
 	
 		static bool CreateStaticMeshFromHoudiniGeoPartObject(
 			const FHoudiniGeoPartObject& InHGPO,
@@ -0,0 +1,291 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#include "HoudiniObjectPathCache.h"
+
+#include "HoudiniEnginePrivatePCH.h"
+
+#include "AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+	struct FHoudiniObjectPathCacheEntry
+	{
+		// Class the path was resolved with
+		const UClass* Class = nullptr;
+		// Resolved object, explicitly null if the resolution failed
+		TWeakObjectPtr<UObject> Object;
+		// Whether the class fallback was allowed for this resolution
+		bool bClassFallback = false;
+	};
+
+	// Cache entries, per normalized object path
+	TMap<FString, TArray<FHoudiniObjectPathCacheEntry>> CachedEntries;
+
+	// Number of failed resolutions added since the last time they were cleared
+	int32 NumFailedEntries = 0;
+
+	// Packages for which an async load has already been requested
+	TSet<FString> PreloadedPackages;
+
+	FDelegateHandle OnAssetAddedHandle;
+	FDelegateHandle OnInMemoryAssetCreatedHandle;
+	FDelegateHandle OnAssetRemovedHandle;
+	FDelegateHandle OnAssetRenamedHandle;
+	FDelegateHandle OnPackageReloadedHandle;
+	FDelegateHandle OnObjectsReplacedHandle;
+}
+
+void
+FHoudiniObjectPathCache::Initialize()
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	OnAssetAddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FHoudiniObjectPathCache::OnAssetAdded);
+	OnAssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FHoudiniObjectPathCache::OnAssetRemoved);
+	OnAssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FHoudiniObjectPathCache::OnAssetRenamed);
+	OnInMemoryAssetCreatedHandle = AssetRegistry.OnInMemoryAssetCreated().AddStatic(&FHoudiniObjectPathCache::OnInMemoryAssetCreated);
+
+	OnPackageReloadedHandle = FCoreUObjectDelegates::OnPackageReloaded.AddStatic(&FHoudiniObjectPathCache::OnPackageReloaded);
+#if WITH_EDITOR
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddStatic(&FHoudiniObjectPathCache::OnObjectsReplaced);
+#endif
+}
+
+void
+FHoudiniObjectPathCache::Shutdown()
+{
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::GetModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.OnAssetAdded().Remove(OnAssetAddedHandle);
+		AssetRegistry.OnAssetRemoved().Remove(OnAssetRemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(OnAssetRenamedHandle);
+		AssetRegistry.OnInMemoryAssetCreated().Remove(OnInMemoryAssetCreatedHandle);
+	}
+
+	FCoreUObjectDelegates::OnPackageReloaded.Remove(OnPackageReloadedHandle);
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+#endif
+
+	OnAssetAddedHandle.Reset();
+	OnAssetRemovedHandle.Reset();
+	OnAssetRenamedHandle.Reset();
+	OnInMemoryAssetCreatedHandle.Reset();
+	OnPackageReloadedHandle.Reset();
+	OnObjectsReplacedHandle.Reset();
+
+	InvalidateAll();
+}
+
+FString
+FHoudiniObjectPathCache::GetNormalizedPath(const FString& InPath)
+{
+	FString ObjectPath;
+	if (FPackageName::ParseExportTextPath(InPath, nullptr, &ObjectPath))
+		return ObjectPath;
+
+	return InPath;
+}
+
+UObject*
+FHoudiniObjectPathCache::LoadObjectFromPath(
+	const FString& InPath,
+	UClass* InClass,
+	const bool& bInAllowClassFallback,
+	const uint32& InLoadFlags)
+{
+	if (InPath.IsEmpty() || !InClass)
+		return nullptr;
+
+	const FString NormalizedPath = GetNormalizedPath(InPath);
+	TArray<FHoudiniObjectPathCacheEntry>& PathEntries = CachedEntries.FindOrAdd(NormalizedPath);
+	for (int32 EntryIdx = 0; EntryIdx < PathEntries.Num(); EntryIdx++)
+	{
+		FHoudiniObjectPathCacheEntry& CurEntry = PathEntries[EntryIdx];
+		if (CurEntry.Class != InClass || CurEntry.bClassFallback != bInAllowClassFallback)
+			continue;
+
+		// Failed resolutions stay failed until an asset is added, renamed or created
+		if (CurEntry.Object.IsExplicitlyNull())
+			return nullptr;
+
+		UObject* CachedObject = CurEntry.Object.Get();
+		if (CachedObject && !CachedObject->IsPendingKill())
+			return CachedObject;
+
+		// The object has been destroyed, resolve it again
+		PathEntries.RemoveAtSwap(EntryIdx);
+		break;
+	}
+
+	UObject* FoundObject = StaticLoadObject(InClass, nullptr, *InPath, nullptr, InLoadFlags, nullptr);
+	if (!FoundObject && bInAllowClassFallback)
+	{
+		// See if the ref is a class that we can instantiate
+		FoundObject = FindObject<UClass>(ANY_PACKAGE, *InPath);
+	}
+
+	if (FoundObject && FoundObject->IsPendingKill())
+		FoundObject = nullptr;
+
+	FHoudiniObjectPathCacheEntry NewEntry;
+	NewEntry.Class = InClass;
+	NewEntry.Object = FoundObject;
+	NewEntry.bClassFallback = bInAllowClassFallback;
+	PathEntries.Add(NewEntry);
+
+	if (!FoundObject)
+		NumFailedEntries++;
+
+	return FoundObject;
+}
+
+void
+FHoudiniObjectPathCache::PreloadObjectPaths(const TArray<FString>& InPaths)
+{
+	for (const FString& CurPath : InPaths)
+	{
+		const FString NormalizedPath = GetNormalizedPath(CurPath);
+		if (CachedEntries.Contains(NormalizedPath))
+			continue;
+
+		const FString PackageName = FPackageName::ObjectPathToPackageName(NormalizedPath);
+		if (!FPackageName::IsValidLongPackageName(PackageName))
+			continue;
+
+		if (PreloadedPackages.Contains(PackageName))
+			continue;
+
+		PreloadedPackages.Add(PackageName);
+
+		// Only request the packages that aren't loaded yet and exist on disk
+		if (FindPackage(nullptr, *PackageName) || !FPackageName::DoesPackageExist(PackageName))
+			continue;
+
+		LoadPackageAsync(PackageName);
+	}
+}
+
+void
+FHoudiniObjectPathCache::Invalidate(const FString& InPath)
+{
+	const FString NormalizedPath = GetNormalizedPath(InPath);
+	CachedEntries.Remove(NormalizedPath);
+	PreloadedPackages.Remove(FPackageName::ObjectPathToPackageName(NormalizedPath));
+}
+
+void
+FHoudiniObjectPathCache::InvalidateAll()
+{
+	CachedEntries.Empty();
+	PreloadedPackages.Empty();
+	NumFailedEntries = 0;
+}
+
+void
+FHoudiniObjectPathCache::InvalidateFailedEntries()
+{
+	if (NumFailedEntries <= 0)
+		return;
+
+	// Failed resolutions can be keyed by a different path than the new asset's
+	// (class paths with a _C suffix, class fallbacks, export text paths), so remove all of them
+	for (auto It = CachedEntries.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAllSwap([](const FHoudiniObjectPathCacheEntry& InEntry) { return InEntry.Object.IsExplicitlyNull(); });
+		if (It.Value().Num() <= 0)
+			It.RemoveCurrent();
+	}
+
+	NumFailedEntries = 0;
+}
+
+void
+FHoudiniObjectPathCache::OnAssetAdded(const FAssetData& InAssetData)
+{
+	// The new asset could resolve a path that previously failed
+	if (CachedEntries.Num() > 0)
+		Invalidate(InAssetData.ObjectPath.ToString());
+
+	InvalidateFailedEntries();
+}
+
+void
+FHoudiniObjectPathCache::OnInMemoryAssetCreated(UObject* InObject)
+{
+	InvalidateFailedEntries();
+}
+
+void
+FHoudiniObjectPathCache::OnAssetRemoved(const FAssetData& InAssetData)
+{
+	Invalidate(InAssetData.ObjectPath.ToString());
+}
+
+void
+FHoudiniObjectPathCache::OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	Invalidate(InOldObjectPath);
+	Invalidate(InAssetData.ObjectPath.ToString());
+
+	InvalidateFailedEntries();
+}
+
+void
+FHoudiniObjectPathCache::OnPackageReloaded(const EPackageReloadPhase InPackageReloadPhase, FPackageReloadedEvent* InPackageReloadedEvent)
+{
+	// Reloaded packages replace their objects, the previous ones are still valid until the next GC
+	if (InPackageReloadPhase == EPackageReloadPhase::PostBatchPreGC)
+		InvalidateAll();
+}
+
+#if WITH_EDITOR
+void
+FHoudiniObjectPathCache::OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacedObjects)
+{
+	// Blueprint compilation and hot reload replace the reinstanced classes and objects,
+	// the old ones are still valid until the next GC
+	for (auto It = CachedEntries.CreateIterator(); It; ++It)
+	{
+		It.Value().RemoveAllSwap([&InReplacedObjects](const FHoudiniObjectPathCacheEntry& InEntry)
+		{
+			if (InReplacedObjects.Contains(const_cast<UClass*>(InEntry.Class)))
+				return true;
+
+			UObject* CachedObject = InEntry.Object.Get(true);
+			return CachedObject && InReplacedObjects.Contains(CachedObject);
+		});
+
+		if (It.Value().Num() <= 0)
+			It.RemoveCurrent();
+	}
+}
+#endif
@@ -0,0 +1,91 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+#include "UObject/UObjectGlobals.h"
+
+class UClass;
+class UObject;
+struct FAssetData;
+
+// Plugin-wide cache of the objects resolved from the asset paths found in attributes
+// (instance references, material overrides...).
+// Objects are held by weak pointers, failed resolutions are cached as well.
+// Entries are invalidated when the assets are removed, renamed, reloaded or reinstanced,
+// failed resolutions are invalidated whenever an asset is added, renamed or created.
+struct HOUDINIENGINE_API FHoudiniObjectPathCache
+{
+	public:
+
+		// Registers the asset events used to invalidate the cache
+		static void Initialize();
+		// Unregisters the asset events and empties the cache
+		static void Shutdown();
+
+		// Returns the object of the given class for a path, loading it if needed.
+		// If bInAllowClassFallback is true and no object could be loaded,
+		// looks for a class of that name instead (used for instancing actor classes).
+		static UObject* LoadObjectFromPath(
+			const FString& InPath,
+			UClass* InClass,
+			const bool& bInAllowClassFallback = false,
+			const uint32& InLoadFlags = LOAD_None);
+
+		template<class T>
+		static T* LoadObjectFromPath(const FString& InPath, const uint32& InLoadFlags = LOAD_None)
+		{
+			return Cast<T>(LoadObjectFromPath(InPath, T::StaticClass(), false, InLoadFlags));
+		}
+
+		// Starts loading asynchronously the packages of the given paths that are not in memory yet,
+		// so the following loads only have to wait for them instead of loading them one by one
+		static void PreloadObjectPaths(const TArray<FString>& InPaths);
+
+		// Removes the entries for a given path
+		static void Invalidate(const FString& InPath);
+		// Removes all the entries
+		static void InvalidateAll();
+
+	private:
+
+		// Converts export text paths (Class'/Path/To.Object') to object paths
+		static FString GetNormalizedPath(const FString& InPath);
+
+		// Removes all the failed resolutions
+		static void InvalidateFailedEntries();
+
+		static void OnAssetAdded(const FAssetData& InAssetData);
+		static void OnAssetRemoved(const FAssetData& InAssetData);
+		static void OnAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+		static void OnInMemoryAssetCreated(UObject* InObject);
+		static void OnPackageReloaded(const EPackageReloadPhase InPackageReloadPhase, FPackageReloadedEvent* InPackageReloadedEvent);
+#if WITH_EDITOR
+		static void OnObjectsReplaced(const TMap<UObject*, UObject*>& InReplacedObjects);
+#endif
+};
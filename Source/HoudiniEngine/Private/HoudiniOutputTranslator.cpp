@@ -41,6 +41,7 @@
 #include "HoudiniEngineRuntime.h"
 #include "HoudiniInput.h"
 #include "HoudiniStaticMesh.h"
+#include "HoudiniStaticMeshComponent.h"
 
 #include "HoudiniMeshTranslator.h"
 #include "HoudiniSplineTranslator.h"
@@ -61,6 +62,47 @@
 
 #define LOCTEXT_NAMESPACE HOUDINI_LOCTEXT_NAMESPACE
 
+// Adds the output to the identity map for all the hashes of the given HGPO
+static void
+AddOutputToIdentityMap(TMultiMap<uint32, UHoudiniOutput*>& InOutOutputsByIdentity, const FHoudiniGeoPartObject& InHGPO, UHoudiniOutput* InOutput)
+{
+	if (InHGPO.Type == EHoudiniPartType::Volume)
+	{
+		InOutOutputsByIdentity.AddUnique(InHGPO.GetHeightfieldIdentityHash(), InOutput);
+		return;
+	}
+
+	InOutOutputsByIdentity.AddUnique(InHGPO.GetIdIdentityHash(), InOutput);
+	InOutOutputsByIdentity.AddUnique(InHGPO.GetNameIdentityHash(), InOutput);
+}
+
+// Finds the output with the lowest index that matches the predicate, among the ones indexed with the given hash
+static UHoudiniOutput*
+FindIndexedOutput(
+	const TMultiMap<uint32, UHoudiniOutput*>& InOutputsByIdentity,
+	const uint32& InHash,
+	const TMap<UHoudiniOutput*, int32>& InOutputIndices,
+	TFunctionRef<bool(UHoudiniOutput*)> InPredicate,
+	int32& InOutFoundIndex)
+{
+	UHoudiniOutput* FoundOutput = nullptr;
+	for (auto It = InOutputsByIdentity.CreateConstKeyIterator(InHash); It; ++It)
+	{
+		UHoudiniOutput* CurrentOutput = It.Value();
+		const int32* OutputIndex = InOutputIndices.Find(CurrentOutput);
+		if (!OutputIndex || *OutputIndex >= InOutFoundIndex)
+			continue;
+
+		if (!InPredicate(CurrentOutput))
+			continue;
+
+		FoundOutput = CurrentOutput;
+		InOutFoundIndex = *OutputIndex;
+	}
+
+	return FoundOutput;
+}
+
 // 
 bool
 FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool& bInForceUpdate, bool& bOutHasHoudiniStaticMeshOutput)
@@ -68,12 +110,18 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	if (!HAC || HAC->IsPendingKill())
 		return false;
 
+	// Keep the parts' attribute manifests gathered by BuildAllOutputs until all the outputs have been processed
+	FHoudiniAttributeManifestScope AttributeManifestScope;
+
 	// Get the bake folder override
 	FHoudiniOutputTranslator::GetBakeFolderFromAttribute(HAC);
 
 	// Get the temp folder override
 	FHoudiniOutputTranslator::GetTempFolderFromAttribute(HAC);
 
+	// Indicates if the outputs' change sets can be used to skip the parts that haven't changed
+	bool bUseChangeSets = false;
+
 	// Check if the HDA has been marked as not producing outputs
 	if (!HAC->bOutputless)
 	{
@@ -88,6 +136,13 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 				ClearOutput(OldOutput);
 			}
 		}
+		else if (!bInForceUpdate && FHoudiniOutputTranslator::UpdateTransformOnlyOutputs(HAC))
+		{
+			// Only the objects' transforms have changed,
+			// the existing components have been moved and nothing needs to be rebuilt
+			bOutHasHoudiniStaticMeshOutput = false;
+			return true;
+		}
 
 		TArray<UHoudiniOutput*> NewOutputs;
 		if (FHoudiniOutputTranslator::BuildAllOutputs(HAC->GetAssetId(), HAC, HAC->Outputs, NewOutputs, HAC->bOutputTemplateGeos))
@@ -95,6 +150,9 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 			ClearAndRemoveOutputs(HAC);
 			// Replace with the new parameters
 			HAC->Outputs = NewOutputs;
+
+			// The outputs' change sets now describe this cook, use them to only process what has changed
+			bUseChangeSets = !bInForceUpdate && !HAC->HasBeenLoaded();
 		}
 	}
 	else
@@ -154,9 +212,24 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	TArray<UHoudiniOutput*> InstancerOutputs;
 	int32 NumInstances = 0;
 	bool bHasObjectInstancer = false;
+
+	// Instancers need to be updated when the meshes they instance have changed,
+	// and landscape tiles are processed together
+	bool bHasMeshChanges = false;
+	bool bHasLandscapeChanges = false;
 	
 	for (auto& CurOutput : HAC->Outputs)
 	{
+		const bool bOutputHasChanges = !bUseChangeSets || CurOutput->GetChangeSet().HasChanges();
+		if (CurOutput->GetType() == EHoudiniOutputType::Mesh)
+		{
+			bHasMeshChanges |= bOutputHasChanges;
+		}
+		else if (CurOutput->GetType() == EHoudiniOutputType::Landscape)
+		{
+			bHasLandscapeChanges |= bOutputHasChanges;
+		}
+
 		if (CurOutput->GetType() == EHoudiniOutputType::Instancer)
 		{
 			// InstancerOutputs.Add(CurOutput);
@@ -260,12 +333,25 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 					}
 				}
 
-				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
-					CurOutput, 
-					PackageParams, 
-					bIsProxyStaticMeshEnabled ? EHoudiniStaticMeshMethod::UHoudiniStaticMesh : HAC->StaticMeshMethod,
-					HAC->StaticMeshGenerationProperties,
-					OuterComponent);
+				const EHoudiniStaticMeshMethod StaticMeshMethod = bIsProxyStaticMeshEnabled ? EHoudiniStaticMeshMethod::UHoudiniStaticMesh : HAC->StaticMeshMethod;
+
+				// Existing proxies need to be rebuilt if we're not using proxies anymore
+				const bool bNeedsProxyRebuild = CurOutput->HasAnyCurrentProxy() && StaticMeshMethod != EHoudiniStaticMeshMethod::UHoudiniStaticMesh;
+				const bool bSkipUnchangedOutput = bUseChangeSets && !bNeedsProxyRebuild
+					&& !CurOutput->GetChangeSet().HasChanges() && CurOutput->GetOutputObjects().Num() > 0;
+
+				if (!bSkipUnchangedOutput)
+				{
+					FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
+						CurOutput,
+						PackageParams,
+						StaticMeshMethod,
+						HAC->StaticMeshGenerationProperties,
+						OuterComponent,
+						false,
+						false,
+						bUseChangeSets);
+				}
 
 				NumVisibleOutputs++;
 
@@ -330,6 +416,13 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 		{
 			NumVisibleOutputs++;
 
+			// Landscapes don't need to be updated if none of their tiles have changed
+			if (!bHasLandscapeChanges && InputLandscapesToUpdate.Num() <= 0 && CurOutput->GetOutputObjects().Num() > 0)
+			{
+				bHasLandscape = true;
+				break;
+			}
+
 			// This gets called for each heightfield primitive from Houdini, i.e., each "tile".
 			bool bNewMapCreated = false;
 			// Registering of untracked actors is not currently used in the HDA
@@ -387,7 +480,13 @@ FHoudiniOutputTranslator::UpdateOutputs(UHoudiniAssetComponent* HAC, const bool&
 	// Now that all meshes have been created, process the instancers
 	for (auto& CurOutput : InstancerOutputs)
 	{
-		FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
+		// Instancers that haven't changed and don't instance any modified mesh keep their components
+		const bool bSkipUnchangedOutput = bUseChangeSets && !bHasMeshChanges
+			&& !CurOutput->GetChangeSet().HasChanges() && CurOutput->GetOutputObjects().Num() > 0;
+
+		if (!bSkipUnchangedOutput)
+			FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutput(CurOutput, HAC->Outputs, OuterComponent);
+
 		NumVisibleOutputs++;
 	}
 
@@ -587,6 +686,10 @@ FHoudiniOutputTranslator::UpdateLoadedOutputs(UHoudiniAssetComponent* HAC)
 	TArray<HAPI_NodeId> EditableCurvePartIds;
 	TArray<FString> EditableCurvePartNames;
 
+	// Geo nodes that have been manually cooked during this discovery pass
+	TSet<HAPI_NodeId> CookedGeoNodeIds;
+	const int32 AssetCookCount = HAC->GetAssetCookCount();
+
 	// Iterate through all objects to get all editable curve's object geo and part Ids.
 
 	for (int32 ObjectId = 0; ObjectId < ObjectInfos.Num(); ++ObjectId)
@@ -633,13 +736,10 @@ FHoudiniOutputTranslator::UpdateLoadedOutputs(UHoudiniAssetComponent* HAC)
 				if (CurrentEditableGeoInfo.type != HAPI_GeoType::HAPI_GEOTYPE_CURVE)
 					continue;
 
-				// Cook the editable node to get its parts
-				if (CurrentEditableGeoInfo.partCount <= 0)
+				// Cook the editable node to get its parts, unless it has already been cooked
+				if (GeoNeedsDiscoveryCook(CurrentEditableGeoInfo, false, AssetCookCount)
+					&& CookGeoForDiscovery(CurrentEditableGeoInfo.nodeId, AssetId, AssetCookCount, CookedGeoNodeIds))
 				{
-					//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-					//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentEditableGeoInfo.nodeId, &CookOptions);
-					FHoudiniEngineUtils::HapiCookNode(CurrentEditableGeoInfo.nodeId, nullptr, true);
-
 					HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
 						FHoudiniEngine::Get().GetSession(),
 						CurrentEditableGeoInfo.nodeId,
@@ -818,6 +918,9 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 		return false;
 	}
 
+	// The attribute manifests gathered for each part are used to answer the attribute queries
+	FHoudiniAttributeManifestScope AttributeManifestScope;
+
 	// Get the AssetInfo
 	HAPI_AssetInfo AssetInfo;
 	FHoudiniApi::AssetInfo_Init(&AssetInfo);
@@ -856,6 +959,49 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			CurOutput->MarkAllHGPOsAsStale(true);
 	}
 
+	// Index the old outputs by their HGPOs' identity hashes,
+	// so new HGPOs can be matched to their output without a linear search.
+	// Old outputs are removed from the indices map once they've been reused.
+	TMultiMap<uint32, UHoudiniOutput*> OldOutputsByIdentity;
+	TMap<UHoudiniOutput*, int32> OldOutputIndices;
+	bool bHasLoadedOldHGPO = false;
+	for (int32 OldIdx = 0; OldIdx < InOldOutputs.Num(); OldIdx++)
+	{
+		UHoudiniOutput* CurOutput = InOldOutputs[OldIdx];
+		if (!CurOutput || OldOutputIndices.Contains(CurOutput))
+			continue;
+
+		OldOutputIndices.Add(CurOutput, OldIdx);
+		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+		{
+			AddOutputToIdentityMap(OldOutputsByIdentity, CurHGPO, CurOutput);
+			bHasLoadedOldHGPO |= CurHGPO.bLoaded;
+		}
+	}
+
+	// Index the new outputs' heightfields the same way
+	TMultiMap<uint32, UHoudiniOutput*> NewOutputsByHeightfield;
+	TMap<UHoudiniOutput*, int32> NewOutputIndices;
+	auto AddToNewOutputs = [&OutNewOutputs, &NewOutputsByHeightfield, &NewOutputIndices](UHoudiniOutput* InOutput)
+	{
+		if (NewOutputIndices.Contains(InOutput))
+			return;
+
+		NewOutputIndices.Add(InOutput, OutNewOutputs.Add(InOutput));
+		for (const FHoudiniGeoPartObject& CurHGPO : InOutput->GetHoudiniGeoPartObjects())
+		{
+			if (CurHGPO.Type == EHoudiniPartType::Volume)
+				NewOutputsByHeightfield.AddUnique(CurHGPO.GetHeightfieldIdentityHash(), InOutput);
+		}
+	};
+
+	{
+		TArray<UHoudiniOutput*> PreviousNewOutputs = MoveTemp(OutNewOutputs);
+		OutNewOutputs.Empty(PreviousNewOutputs.Num());
+		for (UHoudiniOutput* CurOutput : PreviousNewOutputs)
+			AddToNewOutputs(CurOutput);
+	}
+
 	// For HF / Volumes, we only create new Outputs for height volume
 	// Store all the other volumes (masks etc)  on the side and we will
 	// match them with theit corresponding height volume after
@@ -863,6 +1009,12 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 
 	TArray<FHoudiniMeshSocket> AllSockets;
 
+	// Geo nodes that have been manually cooked during this discovery pass
+	TSet<HAPI_NodeId> CookedGeoNodeIds;
+	// The asset's cook count identifies this discovery pass
+	UHoudiniAssetComponent* OuterHAC = Cast<UHoudiniAssetComponent>(InOuterObject);
+	const int32 AssetCookCount = IsValid(OuterHAC) ? OuterHAC->GetAssetCookCount() : FHoudiniEngineUtils::HapiGetCookCount(AssetId);
+
 	// Iterate through all objects.
 	int32 OutputIdx = 1;
 	for (int32 ObjectId = 0; ObjectId < ObjectInfos.Num(); ++ObjectId)
@@ -990,23 +1142,14 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 			}
 		}
 
+		// Cook the editable/templated nodes that need it to get their parts.
+		// This is done once for all the geos, before iterating on their parts.
+		CookGeosForDiscovery(GeoInfos, InOutputTemplatedGeos, AssetId, AssetCookCount, CookedGeoNodeIds);
+
 		// Iterates through the geos we want to process
 		for (int32 GeoIdx = 0; GeoIdx < GeoInfos.Num(); GeoIdx++)
 		{
-			// Cook editable/templated nodes to get their parts.
 			const HAPI_GeoInfo& CurrentHapiGeoInfo = GeoInfos[GeoIdx];
-			if ((CurrentHapiGeoInfo.isEditable && CurrentHapiGeoInfo.partCount <= 0)
-				|| (CurrentHapiGeoInfo.isTemplated && CurrentHapiGeoInfo.partCount <= 0))
-			{
-				//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-				//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
-				FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-
-				HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
-					FHoudiniEngine::Get().GetSession(),
-					CurrentHapiGeoInfo.nodeId,
-					&GeoInfos[GeoIdx]));
-			}
 
 			// Cache/convert the display geo's info
 			FHoudiniGeoInfo CurrentGeoInfo;
@@ -1024,27 +1167,16 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				HAPI_PartInfo CurrentHapiPartInfo;
 				FHoudiniApi::PartInfo_Init(&CurrentHapiPartInfo);
 
-				// If the geo is templated, cook it manually
-				if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
-				{
-					//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-					//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, &CookOptions);
-					FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-				}
-
 				bool bPartInfoFailed = false;
 				if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetPartInfo(
 					FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, PartId, &CurrentHapiPartInfo))
 				{
 					bPartInfoFailed = true;
 
-					// If the geo is templated, attempt to cook it manually
-					if(CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos)
+					// If the geo is templated and hasn't been cooked yet, attempt to cook it manually
+					if (CurrentHapiGeoInfo.isTemplated && InOutputTemplatedGeos
+						&& CookGeoForDiscovery(CurrentHapiGeoInfo.nodeId, AssetId, AssetCookCount, CookedGeoNodeIds))
 					{
-						//HAPI_CookOptions CookOptions = FHoudiniEngine::GetDefaultCookOptions();
-						//FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentHapiGeoInfo.nodeId, nullptr);
-						FHoudiniEngineUtils::HapiCookNode(CurrentHapiGeoInfo.nodeId, nullptr, true);
-
 						HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
 							FHoudiniEngine::Get().GetSession(),
 							CurrentHapiGeoInfo.nodeId,
@@ -1072,6 +1204,13 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				FHoudiniPartInfo CurrentPartInfo;
 				CachePartInfo(CurrentHapiPartInfo, CurrentPartInfo);
 
+				// Gather the names of all the part's attributes at once, so the attribute existence checks
+				// done for this part don't need to query HAPI
+				// The manifest is shared by all the HGPOs created for this part
+				TSharedPtr<FHoudiniAttributeManifest> CurrentAttributeManifest = MakeShared<FHoudiniAttributeManifest>();
+				if (FHoudiniEngineUtils::HapiGetAttributeManifest(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo, *CurrentAttributeManifest))
+					FHoudiniEngineUtils::RegisterAttributeManifest(CurrentHapiGeoInfo.nodeId, CurrentHapiPartInfo.id, CurrentAttributeManifest);
+
 				// Retrieve part name.
 				FString CurrentPartName = CurrentPartInfo.Name;
 
@@ -1236,6 +1375,7 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				currentHGPO.ObjectInfo = CurrentObjectInfo;
 				currentHGPO.GeoInfo = CurrentGeoInfo;
 				currentHGPO.PartInfo = CurrentPartInfo;
+				currentHGPO.AttributeManifest = CurrentAttributeManifest;
 
 				// We only support meshes for templated geos
 				if (currentHGPO.bIsTemplated && (CurrentPartType != EHoudiniPartType::Mesh))
@@ -1395,34 +1535,58 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 
 				// See if we have an existing output that matches this HGPO or if we need to create a new one
 				bool IsFoundOutputValid = false;
-				UHoudiniOutput ** FoundHoudiniOutput = nullptr;	
+				UHoudiniOutput * FoundHoudiniOutput = nullptr;
 				// We handle volumes differently than other outputs types, as a single HF output has multiple HGPOs
 				if (currentHGPO.Type != EHoudiniPartType::Volume)
 				{
 					// Look in the previous output if we have a match
-					FoundHoudiniOutput = InOldOutputs.FindByPredicate(
-						[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HasHoudiniGeoPartObject(currentHGPO) : false; });
+					if (bHasLoadedOldHGPO)
+					{
+						// Loaded HGPOs can be matched by their part name only, so we can't rely on their identity hash
+						UHoudiniOutput ** FoundOldOutput = InOldOutputs.FindByPredicate(
+							[&currentHGPO, &OldOutputIndices](UHoudiniOutput* Output) 
+							{
+								return (Output && OldOutputIndices.Contains(Output)) ? Output->HasHoudiniGeoPartObject(currentHGPO) : false; 
+							});
+						FoundHoudiniOutput = FoundOldOutput ? *FoundOldOutput : nullptr;
+					}
+					else
+					{
+						auto HasHGPO = [&currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HasHoudiniGeoPartObject(currentHGPO) : false; };
+						int32 FoundIndex = MAX_int32;
+						UHoudiniOutput* FoundById = FindIndexedOutput(
+							OldOutputsByIdentity, currentHGPO.GetIdIdentityHash(), OldOutputIndices, HasHGPO, FoundIndex);
+						UHoudiniOutput* FoundByName = FindIndexedOutput(
+							OldOutputsByIdentity, currentHGPO.GetNameIdentityHash(), OldOutputIndices, HasHGPO, FoundIndex);
+						FoundHoudiniOutput = FoundByName ? FoundByName : FoundById;
+					}
 
-					if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+					if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 						IsFoundOutputValid = true;
 
 				}
 				else
 				{
 					// Look in the previous outputs if we have a match
-					FoundHoudiniOutput = InOldOutputs.FindByPredicate(
-						[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, true) : false; });
+					int32 FoundIndex = MAX_int32;
+					FoundHoudiniOutput = FindIndexedOutput(
+						OldOutputsByIdentity, currentHGPO.GetHeightfieldIdentityHash(), OldOutputIndices,
+						[&currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, true) : false; },
+						FoundIndex);
 					
-					if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+					if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 						IsFoundOutputValid = true;
 
 					// If we dont have a match in the old maps, also look in the newly created outputs
 					if (!IsFoundOutputValid)
 					{
-						FoundHoudiniOutput = OutNewOutputs.FindByPredicate(
-							[currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, false) : false; });
+						FoundIndex = MAX_int32;
+						FoundHoudiniOutput = FindIndexedOutput(
+							NewOutputsByHeightfield, currentHGPO.GetHeightfieldIdentityHash(), NewOutputIndices,
+							[&currentHGPO](UHoudiniOutput* Output) { return Output ? Output->HeightfieldMatch(currentHGPO, false) : false; },
+							FoundIndex);
 
-						if (FoundHoudiniOutput && *FoundHoudiniOutput && !(*FoundHoudiniOutput)->IsPendingKill())
+						if (FoundHoudiniOutput && !FoundHoudiniOutput->IsPendingKill())
 							IsFoundOutputValid = true;
 					}
 				}
@@ -1431,10 +1595,11 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				if (IsFoundOutputValid)
 				{
 					// We can reuse the existing output
-					HoudiniOutput = *FoundHoudiniOutput;
+					HoudiniOutput = FoundHoudiniOutput;
 					HoudiniOutput->SetIsUpdating(true);
 					// Transfer this output from the old array to the new one
-					InOldOutputs.Remove(HoudiniOutput);
+					// (the old array is updated once all HGPOs have been processed)
+					OldOutputIndices.Remove(HoudiniOutput);
 				}
 				else
 				{
@@ -1471,11 +1636,22 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 				// Add the HGPO to the output
 				HoudiniOutput->AddNewHGPO(currentHGPO);
 				// Add this output object to the new ouput array
-				OutNewOutputs.AddUnique(HoudiniOutput);
+				if (NewOutputIndices.Contains(HoudiniOutput))
+				{
+					if (currentHGPO.Type == EHoudiniPartType::Volume)
+						NewOutputsByHeightfield.AddUnique(currentHGPO.GetHeightfieldIdentityHash(), HoudiniOutput);
+				}
+				else
+				{
+					AddToNewOutputs(HoudiniOutput);
+				}
 			}
 		}
 	}
 
+	// Remove the reused outputs from the old outputs array
+	InOldOutputs.RemoveAll([&NewOutputIndices](UHoudiniOutput* Output) { return NewOutputIndices.Contains(Output); });
+
 	// Update the output/HGPO associations from the map
 	// Clear the old HGPO since we don't need them anymore
 	for (auto& CurrentOuput : OutNewOutputs)
@@ -1492,20 +1668,23 @@ FHoudiniOutputTranslator::BuildAllOutputs(
 	{
 		for (auto& currentVolumeHGPO : UnassignedVolumeParts)
 		{
-			UHoudiniOutput ** FoundHoudiniOutput = OutNewOutputs.FindByPredicate(
-				[currentVolumeHGPO](UHoudiniOutput* Output) 
+			int32 FoundIndex = MAX_int32;
+			UHoudiniOutput * FoundHoudiniOutput = FindIndexedOutput(
+				NewOutputsByHeightfield, currentVolumeHGPO.GetHeightfieldIdentityHash(), NewOutputIndices,
+				[&currentVolumeHGPO](UHoudiniOutput* Output) 
 				{
 					return Output ? Output->HeightfieldMatch(currentVolumeHGPO, false) : false;
-				});
+				},
+				FoundIndex);
 
-			if (!FoundHoudiniOutput || !(*FoundHoudiniOutput) || (*FoundHoudiniOutput)->IsPendingKill())
+			if (!FoundHoudiniOutput || FoundHoudiniOutput->IsPendingKill())
 			{
 				// Skip - consider this volume as invalid
 				continue;
 			}
 
 			// Add this HGPO to the output
-			(*FoundHoudiniOutput)->AddNewHGPO(currentVolumeHGPO);
+			FoundHoudiniOutput->AddNewHGPO(currentVolumeHGPO);
 		} 
 	}
 
@@ -1593,6 +1772,329 @@ FHoudiniOutputTranslator::UpdateChangedOutputs(UHoudiniAssetComponent* HAC)
 	return true;
 }
 
+// Cook counts recorded for a geo node at its last discovery
+struct FHoudiniGeoDiscoveryCookCount
+{
+	// The asset the geo belongs to
+	HAPI_NodeId AssetId = -1;
+	// The asset's cook count when the geo was last discovered
+	int32 AssetCookCount = -1;
+	// The geo's own cook count at that time
+	int32 GeoCookCount = -1;
+};
+
+// Geo node id -> cook counts at the last discovery of that geo
+static TMap<HAPI_NodeId, FHoudiniGeoDiscoveryCookCount> GeoDiscoveryCookCounts;
+
+void
+FHoudiniOutputTranslator::ClearDiscoveryCookCounts(const HAPI_NodeId& InAssetId)
+{
+	// Node ids are reused by new nodes, so forget the geos of deleted assets
+	if (InAssetId < 0)
+	{
+		GeoDiscoveryCookCounts.Empty();
+		return;
+	}
+
+	for (auto It = GeoDiscoveryCookCounts.CreateIterator(); It; ++It)
+	{
+		if (It.Value().AssetId == InAssetId)
+			It.RemoveCurrent();
+	}
+}
+
+bool
+FHoudiniOutputTranslator::GeoNeedsDiscoveryCook(const HAPI_GeoInfo& InGeoInfo, const bool& bInCookTemplatedGeos, const int32& InAssetCookCount)
+{
+	if (InGeoInfo.nodeId < 0)
+		return false;
+
+	// Only editable/templated geos may need a manual cook
+	const bool bCookTemplated = InGeoInfo.isTemplated && bInCookTemplatedGeos;
+	if (!bCookTemplated && !InGeoInfo.isEditable && !InGeoInfo.isTemplated)
+		return false;
+
+	if (!bCookTemplated && InGeoInfo.partCount > 0)
+		return false;
+
+	const int32 GeoCookCount = FHoudiniEngineUtils::HapiGetCookCount(InGeoInfo.nodeId);
+	if (GeoCookCount <= 0)
+		return true;
+
+	// Geos we haven't discovered yet might hold stale parts
+	FHoudiniGeoDiscoveryCookCount* LastCookCount = GeoDiscoveryCookCounts.Find(InGeoInfo.nodeId);
+	if (!LastCookCount)
+		return true;
+
+	// The geo has already been discovered since the asset's last cook
+	if (InAssetCookCount >= 0 && LastCookCount->AssetCookCount == InAssetCookCount)
+		return false;
+
+	// Templated geos are not on the display path, so the asset's cook does not update them
+	if (bCookTemplated)
+		return true;
+
+	// The asset has cooked since the last discovery.
+	// If the geo has been cooked along with it, it simply has no parts:
+	// cooking it again would not give us any.
+	if (GeoCookCount != LastCookCount->GeoCookCount)
+	{
+		LastCookCount->AssetCookCount = InAssetCookCount;
+		LastCookCount->GeoCookCount = GeoCookCount;
+		return false;
+	}
+
+	// The geo hasn't been cooked since the last discovery, it needs to catch up with the asset
+	return true;
+}
+
+bool
+FHoudiniOutputTranslator::CookGeoForDiscovery(const HAPI_NodeId& InGeoNodeId, const HAPI_NodeId& InAssetId, const int32& InAssetCookCount, TSet<HAPI_NodeId>& InOutCookedNodeIds)
+{
+	if (InGeoNodeId < 0)
+		return false;
+
+	// Only cook each node once per discovery pass
+	bool bAlreadyCooked = false;
+	InOutCookedNodeIds.Add(InGeoNodeId, &bAlreadyCooked);
+	if (bAlreadyCooked)
+		return false;
+
+	const double CookStartTime = FPlatformTime::Seconds();
+	bool bSuccess = FHoudiniEngineUtils::HapiCookNode(InGeoNodeId, nullptr, true);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Output discovery: forced cook of geo node [%d] %s in %.3f seconds."),
+		InGeoNodeId, bSuccess ? TEXT("succeeded") : TEXT("failed"), FPlatformTime::Seconds() - CookStartTime);
+
+	// Keep track of the cook counts so the next discovery can tell if the geo is up to date
+	FHoudiniGeoDiscoveryCookCount& CookCount = GeoDiscoveryCookCounts.FindOrAdd(InGeoNodeId);
+	CookCount.AssetId = InAssetId;
+	CookCount.AssetCookCount = InAssetCookCount;
+	CookCount.GeoCookCount = FHoudiniEngineUtils::HapiGetCookCount(InGeoNodeId);
+
+	return true;
+}
+
+int32
+FHoudiniOutputTranslator::CookGeosForDiscovery(
+	TArray<HAPI_GeoInfo>& InOutGeoInfos,
+	const bool& bInCookTemplatedGeos,
+	const HAPI_NodeId& InAssetId,
+	const int32& InAssetCookCount,
+	TSet<HAPI_NodeId>& InOutCookedNodeIds)
+{
+	int32 NumCooked = 0;
+	for (HAPI_GeoInfo& CurrentGeoInfo : InOutGeoInfos)
+	{
+		if (!GeoNeedsDiscoveryCook(CurrentGeoInfo, bInCookTemplatedGeos, InAssetCookCount))
+			continue;
+
+		if (!CookGeoForDiscovery(CurrentGeoInfo.nodeId, InAssetId, InAssetCookCount, InOutCookedNodeIds))
+			continue;
+
+		NumCooked++;
+
+		// Refresh the geo info to get the cooked parts
+		HOUDINI_CHECK_ERROR(FHoudiniApi::GetGeoInfo(
+			FHoudiniEngine::Get().GetSession(),
+			CurrentGeoInfo.nodeId,
+			&CurrentGeoInfo));
+	}
+
+	return NumCooked;
+}
+
+// Returns the component that should be moved along its object for the transform-only fast path
+// Returns false if the component can't be moved in place
+static bool
+GetTransformOnlyComponent(UObject* InComponent, const EHoudiniOutputType& InOutputType, AActor* InOwner, USceneComponent*& OutComponent)
+{
+	OutComponent = nullptr;
+	if (!InComponent || InComponent->IsPendingKill())
+		return true;
+
+	USceneComponent* SceneComponent = Cast<USceneComponent>(InComponent);
+	if (!SceneComponent)
+		return true;
+
+	// Components that aren't owned by our actor (ie. foliage) need a full update
+	if (SceneComponent->GetOwner() != InOwner)
+		return false;
+
+	// Single instances generate a SMC/HSMC whose transform is the instance's, not the object's
+	if (InOutputType == EHoudiniOutputType::Instancer
+		&& !SceneComponent->IsA<UInstancedStaticMeshComponent>()
+		&& (SceneComponent->IsA<UStaticMeshComponent>() || SceneComponent->IsA<UHoudiniStaticMeshComponent>()))
+	{
+		return true;
+	}
+
+	OutComponent = SceneComponent;
+	return true;
+}
+
+bool
+FHoudiniOutputTranslator::UpdateTransformOnlyOutputs(UHoudiniAssetComponent* HAC)
+{
+	if (!HAC || HAC->IsPendingKill() || HAC->HasBeenLoaded() || HAC->bOutputless)
+		return false;
+
+	if (HAC->Outputs.Num() <= 0)
+		return false;
+
+	const HAPI_NodeId AssetId = HAC->GetAssetId();
+
+	// Get the objects' infos and transforms, this doesn't fetch any geometry
+	TArray<HAPI_ObjectInfo> ObjectInfos;
+	if (!FHoudiniEngineUtils::HapiGetObjectInfos(AssetId, ObjectInfos))
+		return false;
+
+	TArray<HAPI_Transform> ObjectTransforms;
+	if (!FHoudiniEngineUtils::HapiGetObjectTransforms(AssetId, ObjectTransforms))
+		return false;
+
+	if (ObjectTransforms.Num() != ObjectInfos.Num())
+		return false;
+
+	// Get the cached object infos and transforms from our current HGPOs
+	TMap<HAPI_NodeId, const FHoudiniGeoPartObject*> CachedObjects;
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+	{
+		if (!CurOutput || CurOutput->IsPendingKill())
+			return false;
+
+		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+		{
+			if (CurHGPO.bLoaded)
+				return false;
+
+			if (!CachedObjects.Contains(CurHGPO.ObjectId))
+				CachedObjects.Add(CurHGPO.ObjectId, &CurHGPO);
+		}
+	}
+
+	// Find the objects that have moved, any other change requires a full update
+	TMap<int32, FTransform> MovedObjects;
+	int32 NumCachedObjectsFound = 0;
+	for (int32 ObjectIdx = 0; ObjectIdx < ObjectInfos.Num(); ObjectIdx++)
+	{
+		const HAPI_ObjectInfo& CurrentObjectInfo = ObjectInfos[ObjectIdx];
+		if (CurrentObjectInfo.haveGeosChanged)
+			return false;
+
+		const FHoudiniGeoPartObject** CachedHGPO = CachedObjects.Find(CurrentObjectInfo.nodeId);
+		if (!CachedHGPO)
+		{
+			// A visible object that didn't produce any output might produce one now
+			if (CurrentObjectInfo.isVisible)
+				return false;
+
+			continue;
+		}
+
+		NumCachedObjectsFound++;
+
+		const FHoudiniObjectInfo& CachedObjectInfo = (*CachedHGPO)->ObjectInfo;
+		if (CachedObjectInfo.bIsVisible != (bool)CurrentObjectInfo.isVisible
+			|| CachedObjectInfo.bIsInstancer != (bool)CurrentObjectInfo.isInstancer
+			|| CachedObjectInfo.bIsInstanced != (bool)CurrentObjectInfo.isInstanced)
+		{
+			return false;
+		}
+
+		// Material changes aren't reflected in the object infos,
+		// check them on every object, moved or not
+		HAPI_GeoInfo DisplayGeoInfo;
+		FHoudiniApi::GeoInfo_Init(&DisplayGeoInfo);
+		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetDisplayGeoInfo(
+			FHoudiniEngine::Get().GetSession(), CurrentObjectInfo.nodeId, &DisplayGeoInfo))
+		{
+			return false;
+		}
+
+		if (DisplayGeoInfo.hasMaterialChanged)
+			return false;
+
+		FTransform CurrentTransform;
+		FHoudiniEngineUtils::TranslateHapiTransform(ObjectTransforms[ObjectIdx], CurrentTransform);
+		if (CurrentTransform.Equals((*CachedHGPO)->TransformMatrix))
+			continue;
+
+		// Instanced objects are used by instancers, they need to be rebuilt
+		if (CurrentObjectInfo.isInstanced)
+			return false;
+
+		MovedObjects.Add(CurrentObjectInfo.nodeId, CurrentTransform);
+	}
+
+	// Some of our objects do not exist anymore
+	if (NumCachedObjectsFound != CachedObjects.Num())
+		return false;
+
+	if (MovedObjects.Num() <= 0)
+		return false;
+
+	// Make sure all the components of the moved objects can be updated in place
+	AActor* OwnerActor = HAC->GetOwner();
+	TArray<TPair<USceneComponent*, FTransform>> MovedComponents;
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+	{
+		bool bOutputHasMoved = false;
+		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
+		{
+			if (MovedObjects.Contains(CurHGPO.ObjectId))
+			{
+				bOutputHasMoved = true;
+				break;
+			}
+		}
+
+		if (!bOutputHasMoved)
+			continue;
+
+		// Only meshes and instancers can simply be moved
+		const EHoudiniOutputType OutputType = CurOutput->GetType();
+		if (CurOutput->IsEditableNode()
+			|| (OutputType != EHoudiniOutputType::Mesh && OutputType != EHoudiniOutputType::Instancer))
+		{
+			return false;
+		}
+
+		for (auto& Pair : CurOutput->GetOutputObjects())
+		{
+			const FTransform* NewTransform = MovedObjects.Find(Pair.Key.ObjectId);
+			if (!NewTransform)
+				continue;
+
+			USceneComponent* Component = nullptr;
+			if (!GetTransformOnlyComponent(Pair.Value.OutputComponent, OutputType, OwnerActor, Component))
+				return false;
+			if (Component)
+				MovedComponents.Add(TPair<USceneComponent*, FTransform>(Component, *NewTransform));
+
+			if (!GetTransformOnlyComponent(Pair.Value.ProxyComponent, OutputType, OwnerActor, Component))
+				return false;
+			if (Component)
+				MovedComponents.Add(TPair<USceneComponent*, FTransform>(Component, *NewTransform));
+		}
+	}
+
+	// We can now update the HGPOs and move the components
+	// (the outputs that haven't moved get an empty change set)
+	for (UHoudiniOutput* CurOutput : HAC->Outputs)
+		CurOutput->UpdateObjectTransforms(MovedObjects);
+
+	for (auto& MovedComponent : MovedComponents)
+		MovedComponent.Key->SetRelativeTransform(MovedComponent.Value);
+
+	HOUDINI_LOG_MESSAGE(
+		TEXT("Transform only update: moved %d components of %d objects without rebuilding the outputs."),
+		MovedComponents.Num(), MovedObjects.Num());
+
+	return true;
+}
+
 void
 FHoudiniOutputTranslator::CacheObjectInfo(const HAPI_ObjectInfo& InObjInfo, FHoudiniObjectInfo& OutObjInfoCache)
 {
@@ -73,6 +73,27 @@ struct HOUDINIENGINE_API FHoudiniOutputTranslator
 	static bool UpdateChangedOutputs(
 		UHoudiniAssetComponent* HAC);
 
+	// If only the objects' transforms have changed since the last cook,
+	// updates the existing components' transforms and returns true.
+	// Returns false (without modifying anything) if the outputs need to be rebuilt.
+	static bool UpdateTransformOnlyOutputs(UHoudiniAssetComponent* HAC);
+
+	// Output discovery helpers:
+	// Indicates if a geo needs to be cooked manually to expose its parts,
+	// by comparing its cook count to the one recorded at its last discovery
+	static bool GeoNeedsDiscoveryCook(const HAPI_GeoInfo& InGeoInfo, const bool& bInCookTemplatedGeos, const int32& InAssetCookCount);
+	// Cooks a geo node at most once per discovery pass, returns true if the node was cooked
+	static bool CookGeoForDiscovery(const HAPI_NodeId& InGeoNodeId, const HAPI_NodeId& InAssetId, const int32& InAssetCookCount, TSet<HAPI_NodeId>& InOutCookedNodeIds);
+	// Cooks all the geos that need it in one pass and refreshes their geo infos
+	static int32 CookGeosForDiscovery(
+		TArray<HAPI_GeoInfo>& InOutGeoInfos,
+		const bool& bInCookTemplatedGeos,
+		const HAPI_NodeId& InAssetId,
+		const int32& InAssetCookCount,
+		TSet<HAPI_NodeId>& InOutCookedNodeIds);
+	// Forgets the discovery cook counts of an asset's geos, or of all geos if InAssetId is -1
+	static void ClearDiscoveryCookCounts(const HAPI_NodeId& InAssetId = -1);
+
 	// Helpers functions used to convert HAPI types
 	static EHoudiniGeoType ConvertHapiGeoType(const HAPI_GeoType& InType);
 	static EHoudiniPartType ConvertHapiPartType(const HAPI_PartType& InType);
@@ -970,10 +970,183 @@ FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(
 	return true;
 }
 
+bool
+FHoudiniSplineTranslator::HapiCreateLinearCurveInputNodeForData(
+	HAPI_NodeId& CurveNodeId,
+	const FString& InputNodeName,
+	const TArray<FVector>& Positions,
+	const TArray<FQuat>* Rotations,
+	const TArray<FVector>* Scales3d,
+	const bool& InClosed)
+{
+	// We need 2 points to make a curve
+	int32 NumberOfPoints = Positions.Num();
+	if (NumberOfPoints < 2)
+		return false;
+
+	// Check if connected asset id is valid, if it is not, we need to create an input node.
+	if (CurveNodeId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(CurveNodeId))
+	{
+		HAPI_NodeId NodeId = -1;
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CreateInputNode(
+			FHoudiniEngine::Get().GetSession(), &NodeId, TCHAR_TO_ANSI(*InputNodeName)), false);
+
+		if (!FHoudiniEngineUtils::HapiCookNode(NodeId, nullptr, true))
+			return false;
+
+		// Check if we have a valid id for this new input node.
+		if (!FHoudiniEngineUtils::IsHoudiniNodeValid(NodeId))
+			return false;
+
+		CurveNodeId = NodeId;
+	}
+
+	bool bAddRotations = Rotations && (Rotations->Num() == NumberOfPoints);
+	bool bAddScales3d = Scales3d && (Scales3d->Num() == NumberOfPoints);
+
+	// Create a part with a single linear curve
+	HAPI_PartInfo Part;
+	FHoudiniApi::PartInfo_Init(&Part);
+	Part.id = 0;
+	Part.nameSH = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_POINT] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_PRIM] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_VERTEX] = 0;
+	Part.attributeCounts[HAPI_ATTROWNER_DETAIL] = 0;
+	Part.vertexCount = NumberOfPoints;
+	Part.faceCount = 1;
+	Part.pointCount = NumberOfPoints;
+	Part.type = HAPI_PARTTYPE_CURVE;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetPartInfo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &Part), false);
+
+	HAPI_CurveInfo CurveInfo;
+	FHoudiniApi::CurveInfo_Init(&CurveInfo);
+	CurveInfo.curveType = HAPI_CURVETYPE_LINEAR;
+	CurveInfo.curveCount = 1;
+	CurveInfo.vertexCount = NumberOfPoints;
+	CurveInfo.knotCount = 0;
+	CurveInfo.isPeriodic = InClosed;
+	CurveInfo.isRational = false;
+	CurveInfo.order = 2;
+	CurveInfo.hasKnots = false;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveInfo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveInfo), false);
+
+	int32 CurveCount = NumberOfPoints;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveCounts(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveCount, 0, 1), false);
+
+	int32 CurveOrder = 2;
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetCurveOrders(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveOrder, 0, 1), false);
+
+	// Convert the positions, rotations and scales to Houdini
+	TArray<float> CurvePositions;
+	CurvePositions.SetNumUninitialized(NumberOfPoints * 3);
+	for (int32 Idx = 0; Idx < NumberOfPoints; ++Idx)
+	{
+		const FVector& Position = Positions[Idx];
+		CurvePositions[Idx * 3 + 0] = Position.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		CurvePositions[Idx * 3 + 1] = Position.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		CurvePositions[Idx * 3 + 2] = Position.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+	}
+
+	// Create the position (P) attribute
+	HAPI_AttributeInfo AttributeInfoPoint;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+	AttributeInfoPoint.count = NumberOfPoints;
+	AttributeInfoPoint.tupleSize = 3;
+	AttributeInfoPoint.exists = true;
+	AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+		FHoudiniEngine::Get().GetSession(),
+		CurveNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint), false);
+
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+		FHoudiniEngine::Get().GetSession(),
+		CurveNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+		CurvePositions.GetData(), 0, AttributeInfoPoint.count), false);
+
+	if (bAddRotations)
+	{
+		TArray<float> CurveRotations;
+		CurveRotations.SetNumUninitialized(NumberOfPoints * 4);
+		for (int32 Idx = 0; Idx < NumberOfPoints; ++Idx)
+		{
+			const FQuat& RotationQuaternion = (*Rotations)[Idx];
+			CurveRotations[Idx * 4 + 0] = RotationQuaternion.X;
+			CurveRotations[Idx * 4 + 1] = RotationQuaternion.Z;
+			CurveRotations[Idx * 4 + 2] = RotationQuaternion.Y;
+			CurveRotations[Idx * 4 + 3] = -RotationQuaternion.W;
+		}
+
+		HAPI_AttributeInfo AttributeInfoRotation;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoRotation);
+		AttributeInfoRotation.count = NumberOfPoints;
+		AttributeInfoRotation.tupleSize = 4;
+		AttributeInfoRotation.exists = true;
+		AttributeInfoRotation.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoRotation.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoRotation.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			CurveNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			CurveNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation,
+			CurveRotations.GetData(), 0, AttributeInfoRotation.count), false);
+	}
+
+	if (bAddScales3d)
+	{
+		TArray<float> CurveScales;
+		CurveScales.SetNumUninitialized(NumberOfPoints * 3);
+		for (int32 Idx = 0; Idx < NumberOfPoints; ++Idx)
+		{
+			const FVector& ScaleVector = (*Scales3d)[Idx];
+			CurveScales[Idx * 3 + 0] = ScaleVector.X;
+			CurveScales[Idx * 3 + 1] = ScaleVector.Z;
+			CurveScales[Idx * 3 + 2] = ScaleVector.Y;
+		}
+
+		HAPI_AttributeInfo AttributeInfoScale;
+		FHoudiniApi::AttributeInfo_Init(&AttributeInfoScale);
+		AttributeInfoScale.count = NumberOfPoints;
+		AttributeInfoScale.tupleSize = 3;
+		AttributeInfoScale.exists = true;
+		AttributeInfoScale.owner = HAPI_ATTROWNER_POINT;
+		AttributeInfoScale.storage = HAPI_STORAGETYPE_FLOAT;
+		AttributeInfoScale.originalOwner = HAPI_ATTROWNER_INVALID;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::AddAttribute(
+			FHoudiniEngine::Get().GetSession(),
+			CurveNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			CurveNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
+			CurveScales.GetData(), 0, AttributeInfoScale.count), false);
+	}
+
+	// Commit the geo
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), CurveNodeId), false);
+
+	return true;
+}
+
 void
 FHoudiniSplineTranslator::CreatePositionsString(const TArray<FVector>& InPositions, FString& OutPositionString)
 {
 	OutPositionString = TEXT("");
+	// Reserve enough space for the whole string to avoid reallocations
+	OutPositionString.Reserve(InPositions.Num() * 36);
 	for (int32 Idx = 0; Idx < InPositions.Num(); ++Idx)
 	{
 		FVector Position = InPositions[Idx];	
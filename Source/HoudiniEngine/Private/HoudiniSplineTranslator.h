@@ -77,6 +77,17 @@ struct HOUDINIENGINE_API FHoudiniSplineTranslator
 		const bool& InForceClose = false,
 		const FTransform& ParentTransform = FTransform::Identity);
 
+	// Update the curve input node data, or create a new input node if the CurveNodeId is invalid.
+	// Unlike HapiCreateCurveInputNodeForData, this doesn't use a curve SOP: a linear curve is created directly on
+	// an input node, with P, rot and scale sent as point attributes instead of via the curve SOP's coords string.
+	static bool HapiCreateLinearCurveInputNodeForData(
+		HAPI_NodeId& CurveNodeId,
+		const FString& InputNodeName,
+		const TArray<FVector>& Positions,
+		const TArray<FQuat>* Rotations,
+		const TArray<FVector>* Scales3d,
+		const bool& InClosed);
+
 	// Create a default curve node.
 	static bool HapiCreateCurveInputNode(
 		HAPI_NodeId& OutCurveNodeId, const FString& InputNodeName);
@@ -123,8 +123,13 @@ bool FUnrealBrushTranslator::CreateInputNodeForBrush(
 	TArray<ABrush*> BrushActors;
 	UHoudiniInputBrush::FindIntersectingSubtractiveBrushes(InputBrushObject, BrushActors);
 	
-	UModel* BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
-	InputBrushObject->UpdateCachedData(BrushModel, BrushActors);
+	// Only rebuild the CSG model if the brushes have changed since it was last built
+	uint64 BrushesHash = UHoudiniInputBrush::GetBrushesHash(BrushActors);
+	UModel* BrushModel = InputBrushObject->GetCachedModel();
+	if (!IsValid(BrushModel) || InputBrushObject->GetCachedModelHash() != BrushesHash)
+		BrushModel = UHCsgUtils::BuildModelFromBrushes(BrushActors);
+
+	InputBrushObject->UpdateCachedData(BrushModel, BrushActors, BrushesHash);
 	
 	// DEBUG: Upload the level model (baked by UE) to Houdini
 	// ULevel* Level = BrushActor->GetTypedOuter<ULevel>();
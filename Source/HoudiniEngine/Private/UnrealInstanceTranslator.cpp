@@ -42,8 +42,11 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	const bool& bExportLODs,
 	const bool& bExportSockets,
 	const bool& bExportColliders,
-	const bool& bExportAsAttributeInstancer)
+	const bool& bExportAsAttributeInstancer,
+	TArray<uint32>& OutChunkHashes)
 {
+	OutChunkHashes.Empty();
+
 	int32 InstanceCount = ISMC->GetInstanceCount();
 	if (InstanceCount < 1)
 		return true;
@@ -88,35 +91,12 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	{
 		// Get the instance transform and convert them to Position/Rotation/Scale array
 		TArray<float> Positions;
-		Positions.SetNumZeroed(InstanceCount * 3);
 		TArray<float> Rotations;
-		Rotations.SetNumZeroed(InstanceCount * 4);
 		TArray<float> Scales;
-		Scales.SetNumZeroed(InstanceCount * 3);
-		for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
-		{
-			FTransform CurTransform;
-			ISMC->GetInstanceTransform(InstanceIdx, CurTransform);
-
-			// Convert Unreal Position to Houdini
-			FVector PositionVector = CurTransform.GetLocation();
-			Positions[InstanceIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Positions[InstanceIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-			Positions[InstanceIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
-
-			// Convert Unreal Rotation to Houdini
-			FQuat RotationQuaternion = CurTransform.GetRotation();
-			Rotations[InstanceIdx * 4 + 0] = RotationQuaternion.X;
-			Rotations[InstanceIdx * 4 + 1] = RotationQuaternion.Z;
-			Rotations[InstanceIdx * 4 + 2] = RotationQuaternion.Y;
-			Rotations[InstanceIdx * 4 + 3] = -RotationQuaternion.W;
-
-			// Convert Unreal Scale to Houdini
-			FVector ScaleVector = CurTransform.GetScale3D();
-			Scales[InstanceIdx * 3 + 0] = ScaleVector.X;
-			Scales[InstanceIdx * 3 + 1] = ScaleVector.Z;
-			Scales[InstanceIdx * 3 + 2] = ScaleVector.Y;
-		}
+		GetInstancerPointAttributes(ISMC, Positions, Rotations, Scales);
+
+		// Keep track of the uploaded instances so we can later only upload the ones that changed
+		ComputeInstanceChunkHashes(Positions, Rotations, Scales, OutChunkHashes);
 
 		// Create a part for the instance points.
 		HAPI_PartInfo Part;
@@ -209,4 +189,166 @@ FUnrealInstanceTranslator::HapiCreateInputNodeForInstancer(
 	OutCreatedNodeId = CopyNodeId;
 
 	return true;
-}
\ No newline at end of file
+}
+
+bool
+FUnrealInstanceTranslator::HapiUpdateInputNodeForInstancer(
+	UInstancedStaticMeshComponent* ISMC,
+	const HAPI_NodeId& InCopyNodeId,
+	const int32& InUploadedInstanceCount,
+	TArray<uint32>& InOutChunkHashes)
+{
+	if (!ISMC || ISMC->IsPendingKill())
+		return false;
+
+	// If the number of instances has changed, the instances node needs to be recreated
+	int32 InstanceCount = ISMC->GetInstanceCount();
+	if (InstanceCount < 1 || InstanceCount != InUploadedInstanceCount)
+		return false;
+
+	if (InCopyNodeId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(InCopyNodeId))
+		return false;
+
+	// The instances node is connected to the copytopoints node's second input
+	HAPI_NodeId InstancesNodeId = -1;
+	if (HAPI_RESULT_SUCCESS != FHoudiniApi::QueryNodeInput(
+		FHoudiniEngine::Get().GetSession(), InCopyNodeId, 1, &InstancesNodeId))
+		return false;
+
+	if (InstancesNodeId < 0)
+		return false;
+
+	TArray<float> Positions;
+	TArray<float> Rotations;
+	TArray<float> Scales;
+	GetInstancerPointAttributes(ISMC, Positions, Rotations, Scales);
+
+	TArray<uint32> NewChunkHashes;
+	ComputeInstanceChunkHashes(Positions, Rotations, Scales, NewChunkHashes);
+	if (NewChunkHashes.Num() != InOutChunkHashes.Num())
+		return false;
+
+	// Merge consecutive dirty chunks into ranges of points to upload
+	TArray<TPair<int32, int32>> DirtyRanges;
+	for (int32 ChunkIdx = 0; ChunkIdx < NewChunkHashes.Num(); ChunkIdx++)
+	{
+		if (NewChunkHashes[ChunkIdx] == InOutChunkHashes[ChunkIdx])
+			continue;
+
+		int32 Start = ChunkIdx * HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE;
+		int32 Count = FMath::Min(HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE, InstanceCount - Start);
+		if (DirtyRanges.Num() > 0 && (DirtyRanges.Last().Key + DirtyRanges.Last().Value) == Start)
+			DirtyRanges.Last().Value += Count;
+		else
+			DirtyRanges.Add(TPair<int32, int32>(Start, Count));
+	}
+
+	// Nothing has changed, no need to upload anything
+	if (DirtyRanges.Num() <= 0)
+		return true;
+
+	HAPI_AttributeInfo AttributeInfoPoint;
+	FHoudiniApi::AttributeInfo_Init(&AttributeInfoPoint);
+	AttributeInfoPoint.count = InstanceCount;
+	AttributeInfoPoint.tupleSize = 3;
+	AttributeInfoPoint.exists = true;
+	AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+	AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+	AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+	HAPI_AttributeInfo AttributeInfoRotation = AttributeInfoPoint;
+	AttributeInfoRotation.tupleSize = 4;
+
+	HAPI_AttributeInfo AttributeInfoScale = AttributeInfoPoint;
+
+	// Only rewrite the changed point ranges in the existing instances node
+	for (const TPair<int32, int32>& CurRange : DirtyRanges)
+	{
+		const int32& Start = CurRange.Key;
+		const int32& Count = CurRange.Value;
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+			Positions.GetData() + Start * 3, Start, Count), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfoRotation,
+			Rotations.GetData() + Start * 4, Start, Count), false);
+
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetAttributeFloatData(
+			FHoudiniEngine::Get().GetSession(),
+			InstancesNodeId, 0, HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfoScale,
+			Scales.GetData() + Start * 3, Start, Count), false);
+	}
+
+	// Commit the instance point geo.
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+		FHoudiniEngine::Get().GetSession(), InstancesNodeId), false);
+
+	InOutChunkHashes = NewChunkHashes;
+
+	return true;
+}
+
+void
+FUnrealInstanceTranslator::GetInstancerPointAttributes(
+	UInstancedStaticMeshComponent* ISMC,
+	TArray<float>& OutPositions,
+	TArray<float>& OutRotations,
+	TArray<float>& OutScales)
+{
+	int32 InstanceCount = ISMC ? ISMC->GetInstanceCount() : 0;
+	OutPositions.SetNumZeroed(InstanceCount * 3);
+	OutRotations.SetNumZeroed(InstanceCount * 4);
+	OutScales.SetNumZeroed(InstanceCount * 3);
+
+	for (int32 InstanceIdx = 0; InstanceIdx < InstanceCount; InstanceIdx++)
+	{
+		FTransform CurTransform;
+		ISMC->GetInstanceTransform(InstanceIdx, CurTransform);
+
+		// Convert Unreal Position to Houdini
+		FVector PositionVector = CurTransform.GetLocation();
+		OutPositions[InstanceIdx * 3 + 0] = PositionVector.X / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[InstanceIdx * 3 + 1] = PositionVector.Z / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+		OutPositions[InstanceIdx * 3 + 2] = PositionVector.Y / HAPI_UNREAL_SCALE_FACTOR_POSITION;
+
+		// Convert Unreal Rotation to Houdini
+		FQuat RotationQuaternion = CurTransform.GetRotation();
+		OutRotations[InstanceIdx * 4 + 0] = RotationQuaternion.X;
+		OutRotations[InstanceIdx * 4 + 1] = RotationQuaternion.Z;
+		OutRotations[InstanceIdx * 4 + 2] = RotationQuaternion.Y;
+		OutRotations[InstanceIdx * 4 + 3] = -RotationQuaternion.W;
+
+		// Convert Unreal Scale to Houdini
+		FVector ScaleVector = CurTransform.GetScale3D();
+		OutScales[InstanceIdx * 3 + 0] = ScaleVector.X;
+		OutScales[InstanceIdx * 3 + 1] = ScaleVector.Z;
+		OutScales[InstanceIdx * 3 + 2] = ScaleVector.Y;
+	}
+}
+
+void
+FUnrealInstanceTranslator::ComputeInstanceChunkHashes(
+	const TArray<float>& InPositions,
+	const TArray<float>& InRotations,
+	const TArray<float>& InScales,
+	TArray<uint32>& OutChunkHashes)
+{
+	int32 InstanceCount = InPositions.Num() / 3;
+	int32 ChunkCount = FMath::DivideAndRoundUp(InstanceCount, HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE);
+	OutChunkHashes.SetNumUninitialized(ChunkCount);
+
+	for (int32 ChunkIdx = 0; ChunkIdx < ChunkCount; ChunkIdx++)
+	{
+		int32 Start = ChunkIdx * HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE;
+		int32 Count = FMath::Min(HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE, InstanceCount - Start);
+
+		uint32 Hash = FCrc::MemCrc32(InPositions.GetData() + Start * 3, Count * 3 * sizeof(float));
+		Hash = FCrc::MemCrc32(InRotations.GetData() + Start * 4, Count * 4 * sizeof(float), Hash);
+		Hash = FCrc::MemCrc32(InScales.GetData() + Start * 3, Count * 3 * sizeof(float), Hash);
+		OutChunkHashes[ChunkIdx] = Hash;
+	}
+}
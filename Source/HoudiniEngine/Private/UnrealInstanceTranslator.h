@@ -45,5 +45,29 @@ struct HOUDINIENGINE_API FUnrealInstanceTranslator
 			const bool& bExportLODs,
 			const bool& bExportSockets,
 			const bool& bExportColliders,
-			const bool& bExportAsAttributeInstancer);
-};
\ No newline at end of file
+			const bool& bExportAsAttributeInstancer,
+			TArray<uint32>& OutChunkHashes);
+
+		// HAPI : Update the instance points of an existing instancer input node.
+		// Only the chunks of instances whose hash differs from InOutChunkHashes are uploaded.
+		// Returns false if the node can't be updated in place (ie, the instance count changed) and needs to be recreated.
+		static bool HapiUpdateInputNodeForInstancer(
+			UInstancedStaticMeshComponent* ISMC,
+			const HAPI_NodeId& InCopyNodeId,
+			const int32& InUploadedInstanceCount,
+			TArray<uint32>& InOutChunkHashes);
+
+		// Converts the ISMC's instance transforms to Houdini's P/rot/scale point attribute arrays
+		static void GetInstancerPointAttributes(
+			UInstancedStaticMeshComponent* ISMC,
+			TArray<float>& OutPositions,
+			TArray<float>& OutRotations,
+			TArray<float>& OutScales);
+
+		// Computes a hash for each chunk of HAPI_UNREAL_INSTANCER_INPUT_CHUNK_SIZE instances
+		static void ComputeInstanceChunkHashes(
+			const TArray<float>& InPositions,
+			const TArray<float>& InRotations,
+			const TArray<float>& InScales,
+			TArray<uint32>& OutChunkHashes);
+};
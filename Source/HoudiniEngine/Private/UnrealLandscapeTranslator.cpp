@@ -34,6 +34,7 @@
 
 #include "UnrealLandscapeTranslator.h"
 #include "HoudiniGeoPartObject.h"
+#include "HoudiniInputObject.h"
 
 #include "Landscape.h"
 #include "LandscapeDataAccess.h"
@@ -274,11 +275,19 @@ FUnrealLandscapeTranslator::CreateMeshOrPointsFromLandscape(
 
 bool 
 FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
-	ALandscapeProxy* LandscapeProxy, HAPI_NodeId& CreatedHeightfieldNodeId, const FString& InputNodeNameStr) 
+	ALandscapeProxy* LandscapeProxy,
+	HAPI_NodeId& CreatedHeightfieldNodeId,
+	const FString& InputNodeNameStr,
+	UHoudiniInputLandscape* InInputLandscape)
 {
 	if (!LandscapeProxy)
 		return false;
 
+	// Only export the proxy's components extents, for the height and the layers
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
 	// Export the whole landscape and its layer as a single heightfield.
 
 	//--------------------------------------------------------------------------------------------------
@@ -303,6 +312,11 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
 		return false;
 
+	// Keep track of each component's data and of the created volumes,
+	// so that the next uploads only need to send the components that have changed
+	TMap<FIntPoint, uint32> ComponentHashes;
+	UpdateLandscapeComponentHashes(LandscapeProxy, MinX, MinY, HeightfieldVolumeInfo.xLength, HeightfieldFloatValues, ComponentHashes);
+
 	//--------------------------------------------------------------------------------------------------
 	// 3. Create the Heightfield Input Node
 	//-------------------------------------------------------------------------------------------------- 
@@ -354,6 +368,9 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 		FHoudiniEngine::Get().GetSession(), HeightId), false);
 
+	TMap<FString, int32> VolumeNodeIds;
+	VolumeNodeIds.Add(TEXT(HAPI_UNREAL_LANDSCAPE_HEIGHT_VOLUME_NAME), HeightId);
+
 	//--------------------------------------------------------------------------------------------------
     // 5. Extract and convert all the layers
     //--------------------------------------------------------------------------------------------------
@@ -370,7 +387,7 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		TArray<uint8> CurrentLayerIntData;
 		FLinearColor LayerUsageDebugColor;
 		FString LayerName;
-		if (!GetLandscapeLayerData(LandscapeInfo, n, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
+		if (!GetLandscapeLayerData(LandscapeInfo, n, MinX, MinY, MaxX, MaxY, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
 			continue;
 
 		// 2. Convert unreal uint8 values to floats
@@ -443,6 +460,9 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
 			FHoudiniEngine::Get().GetSession(), LayerVolumeNodeId), false);
 
+		VolumeNodeIds.Add(LayerName, LayerVolumeNodeId);
+		UpdateLandscapeComponentHashes(LandscapeProxy, MinX, MinY, CurrentLayerVolumeInfo.xLength, CurrentLayerFloatData, ComponentHashes);
+
 		if (!IsMask)
 		{
 			// We had to create a new volume for this layer, so we need to connect it to the HF's merge node
@@ -509,9 +529,289 @@ FUnrealLandscapeTranslator::CreateHeightfieldFromLandscape(
 
 	CreatedHeightfieldNodeId = HeightFieldId;
 
+	if (InInputLandscape)
+	{
+		InInputLandscape->CachedComponentHashes = ComponentHashes;
+		InInputLandscape->CachedVolumeNodeIds = VolumeNodeIds;
+		InInputLandscape->CachedExtentMin = FIntPoint(MinX, MinY);
+		InInputLandscape->CachedExtentMax = FIntPoint(MaxX, MaxY);
+		InInputLandscape->CachedAttributesHash = GetHeightfieldAttributesHash(LandscapeProxy, HeightfieldVolumeInfo, CenterOffset);
+	}
+
+	return true;
+}
+
+bool
+FUnrealLandscapeTranslator::UpdateHeightfieldFromLandscape(
+	ALandscapeProxy* LandscapeProxy, UHoudiniInputLandscape* InInputLandscape)
+{
+	if (!LandscapeProxy || !InInputLandscape)
+		return false;
+
+	// We can only update a heightfield that has been previously uploaded
+	HAPI_NodeId HeightFieldId = InInputLandscape->InputNodeId;
+	if (HeightFieldId < 0 || !FHoudiniEngineUtils::IsHoudiniNodeValid(HeightFieldId))
+		return false;
+
+	if (InInputLandscape->CachedComponentHashes.Num() <= 0 || InInputLandscape->CachedVolumeNodeIds.Num() <= 0)
+		return false;
+
+	// If the landscape's extents have changed, the heightfield needs to be rebuilt
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
+
+	if (InInputLandscape->CachedExtentMin != FIntPoint(MinX, MinY) || InInputLandscape->CachedExtentMax != FIntPoint(MaxX, MaxY))
+		return false;
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (!LandscapeInfo)
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 1. Extract and convert the height and layers data
+	//--------------------------------------------------------------------------------------------------
+	TArray<uint16> HeightData;
+	int32 XSize, YSize;
+	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
+		return false;
+
+	FVector Origin, Extent;
+	GetLandscapeProxyBounds(LandscapeProxy, Origin, Extent);
+
+	TArray<float> HeightfieldFloatValues;
+	HAPI_VolumeInfo HeightfieldVolumeInfo;
+	FHoudiniApi::VolumeInfo_Init(&HeightfieldVolumeInfo);
+	FVector CenterOffset = FVector::ZeroVector;
+	if (!ConvertLandscapeDataToHeightfieldData(
+		HeightData, XSize, YSize, Origin - Extent, Origin + Extent, LandscapeProxy->ActorToWorld(),
+		HeightfieldFloatValues, HeightfieldVolumeInfo, CenterOffset))
+		return false;
+
+	// Only the volumes' data is updated, the heightfield needs to be rebuilt
+	// if its transform, materials, tags or actor/level paths have changed
+	if (GetHeightfieldAttributesHash(LandscapeProxy, HeightfieldVolumeInfo, CenterOffset) != InInputLandscape->CachedAttributesHash)
+		return false;
+
+	// Volumes to update, in the same order as when they were created
+	TArray<FString> VolumeNames;
+	TArray<TArray<float>> VolumeValues;
+	VolumeNames.Add(TEXT(HAPI_UNREAL_LANDSCAPE_HEIGHT_VOLUME_NAME));
+	VolumeValues.Add(MoveTemp(HeightfieldFloatValues));
+
+	for (int32 n = 0; n < LandscapeInfo->Layers.Num(); n++)
+	{
+		TArray<uint8> CurrentLayerIntData;
+		FLinearColor LayerUsageDebugColor;
+		FString LayerName;
+		if (!GetLandscapeLayerData(LandscapeInfo, n, MinX, MinY, MaxX, MaxY, CurrentLayerIntData, LayerUsageDebugColor, LayerName))
+			continue;
+
+		HAPI_VolumeInfo CurrentLayerVolumeInfo;
+		FHoudiniApi::VolumeInfo_Init(&CurrentLayerVolumeInfo);
+		TArray<float> CurrentLayerFloatData;
+		if (!ConvertLandscapeLayerDataToHeightfieldData(
+			CurrentLayerIntData, XSize, YSize, LayerUsageDebugColor,
+			CurrentLayerFloatData, CurrentLayerVolumeInfo))
+			continue;
+
+		// A new layer has been added, we need to rebuild the heightfield
+		if (!InInputLandscape->CachedVolumeNodeIds.Contains(LayerName))
+			return false;
+
+		VolumeNames.Add(LayerName);
+		VolumeValues.Add(MoveTemp(CurrentLayerFloatData));
+	}
+
+	// A layer has been removed, we need to rebuild the heightfield
+	if (VolumeNames.Num() != InInputLandscape->CachedVolumeNodeIds.Num())
+		return false;
+
+	//--------------------------------------------------------------------------------------------------
+	// 2. Find the components whose data has changed
+	//--------------------------------------------------------------------------------------------------
+	int32 HoudiniXSize = HeightfieldVolumeInfo.xLength;
+	TMap<FIntPoint, uint32> ComponentHashes;
+	for (const TArray<float>& CurrentValues : VolumeValues)
+		UpdateLandscapeComponentHashes(LandscapeProxy, MinX, MinY, HoudiniXSize, CurrentValues, ComponentHashes);
+
+	// Heightfield rows are along the landscape's Y axis, so a component covers
+	// a contiguous range of rows matching its X extents.
+	TArray<TPair<int32, int32>> DirtyRows;
+	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+	{
+		if (!Comp)
+			continue;
+
+		const uint32* NewHash = ComponentHashes.Find(Comp->GetSectionBase());
+		const uint32* OldHash = InInputLandscape->CachedComponentHashes.Find(Comp->GetSectionBase());
+		if (NewHash && OldHash && *NewHash == *OldHash)
+			continue;
+
+		int32 CompMinX = MAX_int32, CompMinY = MAX_int32;
+		int32 CompMaxX = -MAX_int32, CompMaxY = -MAX_int32;
+		Comp->GetComponentExtent(CompMinX, CompMinY, CompMaxX, CompMaxY);
+		DirtyRows.Add(TPair<int32, int32>(CompMinX - MinX, CompMaxX - MinX));
+	}
+
+	if (DirtyRows.Num() > 0)
+	{
+		// Merge the overlapping/adjacent row ranges
+		DirtyRows.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+		TArray<TPair<int32, int32>> MergedRows;
+		for (const TPair<int32, int32>& CurRows : DirtyRows)
+		{
+			if (MergedRows.Num() > 0 && CurRows.Key <= MergedRows.Last().Value + 1)
+				MergedRows.Last().Value = FMath::Max(MergedRows.Last().Value, CurRows.Value);
+			else
+				MergedRows.Add(CurRows);
+		}
+
+		//--------------------------------------------------------------------------------------------------
+		// 3. Only upload the changed rows to the existing volumes
+		//--------------------------------------------------------------------------------------------------
+		for (int32 VolumeIdx = 0; VolumeIdx < VolumeNames.Num(); VolumeIdx++)
+		{
+			HAPI_NodeId VolumeNodeId = InInputLandscape->CachedVolumeNodeIds.FindChecked(VolumeNames[VolumeIdx]);
+			if (!FHoudiniEngineUtils::IsHoudiniNodeValid(VolumeNodeId))
+				return false;
+
+			std::string NameStr;
+			FHoudiniEngineUtils::ConvertUnrealString(VolumeNames[VolumeIdx], NameStr);
+
+			TArray<float>& CurrentValues = VolumeValues[VolumeIdx];
+			for (const TPair<int32, int32>& CurRows : MergedRows)
+			{
+				int32 Start = CurRows.Key * HoudiniXSize;
+				int32 Length = (CurRows.Value - CurRows.Key + 1) * HoudiniXSize;
+				HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::SetHeightFieldData(
+					FHoudiniEngine::Get().GetSession(),
+					VolumeNodeId, 0, NameStr.c_str(), CurrentValues.GetData() + Start, Start, Length), false);
+			}
+
+			HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::CommitGeo(
+				FHoudiniEngine::Get().GetSession(), VolumeNodeId), false);
+		}
+
+		if (!FHoudiniEngineUtils::HapiCookNode(HeightFieldId, nullptr, true))
+			return false;
+	}
+
+	InInputLandscape->CachedComponentHashes = ComponentHashes;
+
 	return true;
 }
 
+bool
+FUnrealLandscapeTranslator::GetLandscapeProxyExtent(
+	ALandscapeProxy* LandscapeProxy,
+	int32& MinX, int32& MinY,
+	int32& MaxX, int32& MaxY)
+{
+	if (!LandscapeProxy)
+		return false;
+
+	MinX = MAX_int32;
+	MinY = MAX_int32;
+	MaxX = -MAX_int32;
+	MaxY = -MAX_int32;
+
+	// To handle streaming proxies correctly, get the extents via all the components,
+	// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
+	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+	{
+		if (Comp)
+			Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
+	}
+
+	return (MinX != MAX_int32);
+}
+
+uint32
+FUnrealLandscapeTranslator::GetHeightfieldAttributesHash(
+	ALandscapeProxy* LandscapeProxy,
+	const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+	const FVector& CenterOffset)
+{
+	if (!LandscapeProxy)
+		return 0;
+
+	// Volume transform and heightfield node/object transforms
+	const HAPI_Transform& VolumeTransform = HeightfieldVolumeInfo.transform;
+	uint32 Hash = FCrc::MemCrc32(VolumeTransform.position, sizeof(VolumeTransform.position));
+	Hash = FCrc::MemCrc32(VolumeTransform.rotationQuaternion, sizeof(VolumeTransform.rotationQuaternion), Hash);
+	Hash = FCrc::MemCrc32(VolumeTransform.scale, sizeof(VolumeTransform.scale), Hash);
+	Hash = FCrc::MemCrc32(&CenterOffset, sizeof(FVector), Hash);
+
+	const FTransform LandscapeTransform = LandscapeProxy->ActorToWorld();
+	const FVector Location = LandscapeTransform.GetLocation();
+	const FQuat Rotation = LandscapeTransform.GetRotation();
+	Hash = FCrc::MemCrc32(&Location, sizeof(FVector), Hash);
+	Hash = FCrc::MemCrc32(&Rotation, sizeof(FQuat), Hash);
+
+	// Material attributes
+	auto HashObjectPath = [&Hash](const UObject* InObject)
+	{
+		Hash = FCrc::StrCrc32(InObject ? *InObject->GetPathName() : TEXT(""), Hash);
+	};
+
+	HashObjectPath(LandscapeProxy->GetLandscapeMaterial());
+	HashObjectPath(LandscapeProxy->GetLandscapeHoleMaterial());
+	HashObjectPath(LandscapeProxy->DefaultPhysMaterial);
+
+	ULandscapeInfo* LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+	if (LandscapeInfo)
+	{
+		for (const FLandscapeInfoLayerSettings& LayerSettings : LandscapeInfo->Layers)
+			HashObjectPath(LayerSettings.LayerInfoObj ? LayerSettings.LayerInfoObj->PhysMaterial : nullptr);
+	}
+
+	// Tag attributes
+	for (const FName& CurrentTag : LandscapeProxy->Tags)
+		Hash = FCrc::StrCrc32(*CurrentTag.ToString(), Hash);
+
+	// Actor and level path attributes
+	HashObjectPath(LandscapeProxy);
+	HashObjectPath(LandscapeProxy->GetLevel());
+
+	return Hash;
+}
+
+void
+FUnrealLandscapeTranslator::UpdateLandscapeComponentHashes(
+	ALandscapeProxy* LandscapeProxy,
+	const int32& MinX, const int32& MinY,
+	const int32& HoudiniXSize,
+	const TArray<float>& HeightfieldValues,
+	TMap<FIntPoint, uint32>& InOutComponentHashes)
+{
+	if (!LandscapeProxy || HoudiniXSize <= 0)
+		return;
+
+	int32 HoudiniYSize = HeightfieldValues.Num() / HoudiniXSize;
+	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
+	{
+		if (!Comp)
+			continue;
+
+		int32 CompMinX = MAX_int32, CompMinY = MAX_int32;
+		int32 CompMaxX = -MAX_int32, CompMaxY = -MAX_int32;
+		Comp->GetComponentExtent(CompMinX, CompMinY, CompMaxX, CompMaxY);
+
+		// Heightfield values are stored with X/Y inverted
+		int32 RowStart = FMath::Max(CompMinX - MinX, 0);
+		int32 RowEnd = FMath::Min(CompMaxX - MinX, HoudiniYSize - 1);
+		int32 ColStart = FMath::Max(CompMinY - MinY, 0);
+		int32 ColCount = FMath::Min(CompMaxY - MinY, HoudiniXSize - 1) - ColStart + 1;
+		if (ColCount <= 0)
+			continue;
+
+		uint32& Hash = InOutComponentHashes.FindOrAdd(Comp->GetSectionBase());
+		for (int32 Row = RowStart; Row <= RowEnd; Row++)
+			Hash = FCrc::MemCrc32(HeightfieldValues.GetData() + Row * HoudiniXSize + ColStart, ColCount * sizeof(float), Hash);
+	}
+}
+
 // Converts Unreal uint16 values to Houdini Float
 bool
 FUnrealLandscapeTranslator::ConvertLandscapeLayerDataToHeightfieldData(
@@ -642,17 +942,9 @@ FUnrealLandscapeTranslator::GetLandscapeData(
 		return false;
 
 	// Get the landscape extents to get its size
-	int32 MinX = MAX_int32;
-	int32 MinY = MAX_int32;
-	int32 MaxX = -MAX_int32;
-	int32 MaxY = -MAX_int32;
-
-	// To handle streaming proxies correctly, get the extents via all the components,
-	// not by calling GetLandscapeExtent or we'll end up sending ALL the streaming proxies.
-	for (const ULandscapeComponent* Comp : LandscapeProxy->LandscapeComponents)
-	{
-		Comp->GetComponentExtent(MinX, MinY, MaxX, MaxY);
-	}
+	int32 MinX, MinY, MaxX, MaxY;
+	if (!GetLandscapeProxyExtent(LandscapeProxy, MinX, MinY, MaxX, MaxY))
+		return false;
 
 	if (!GetLandscapeData(LandscapeInfo, MinX, MinY, MaxX, MaxY, HeightData, XSize, YSize))
 		return false;
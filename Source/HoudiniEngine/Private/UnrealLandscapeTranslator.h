@@ -42,7 +42,35 @@ struct HOUDINIENGINE_API FUnrealLandscapeTranslator
 		static bool CreateHeightfieldFromLandscape(
 			ALandscapeProxy* LandcapeProxy, 
 			HAPI_NodeId& CreatedHeightfieldNodeId,
-			const FString &InputNodeNameStr);
+			const FString &InputNodeNameStr,
+			UHoudiniInputLandscape* InInputLandscape = nullptr);
+
+		// Updates the heightfield previously created for a landscape input in place.
+		// Only the heightfield rows covered by landscape components whose data changed since the last upload are sent.
+		// Returns false if the heightfield can't be updated (size or layers changed...) and needs to be recreated.
+		static bool UpdateHeightfieldFromLandscape(
+			ALandscapeProxy* LandscapeProxy,
+			UHoudiniInputLandscape* InInputLandscape);
+
+		// Gets the extents of a landscape proxy's components
+		static bool GetLandscapeProxyExtent(
+			ALandscapeProxy* LandscapeProxy,
+			int32& MinX, int32& MinY,
+			int32& MaxX, int32& MaxY);
+
+		// Returns a hash of the heightfield's transform and of the attributes added to its volumes
+		static uint32 GetHeightfieldAttributesHash(
+			ALandscapeProxy* LandscapeProxy,
+			const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+			const FVector& CenterOffset);
+
+		// Combines the heightfield values covered by each of the proxy's components into that component's hash
+		static void UpdateLandscapeComponentHashes(
+			ALandscapeProxy* LandscapeProxy,
+			const int32& MinX, const int32& MinY,
+			const int32& HoudiniXSize,
+			const TArray<float>& HeightfieldValues,
+			TMap<FIntPoint, uint32>& InOutComponentHashes);
 
 		// Extracts the uint16 values of a given landscape
 		static bool GetLandscapeData(
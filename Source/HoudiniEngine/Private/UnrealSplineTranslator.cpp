@@ -34,59 +34,230 @@
 #include "HoudiniGeoPartObject.h"
 
 #include "HoudiniSplineTranslator.h"
+#include "HoudiniInputObject.h"
 
-bool
-FUnrealSplineTranslator::CreateInputNodeForSplineComponent(USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId& CreatedInputNodeId, const FString& NodeName) 
+#include "Async/ParallelFor.h"
+
+// A sample of an Unreal spline at a given input key
+struct FUnrealSplineSample
+{
+	float Key;
+	FVector Position;
+	FQuat Rotation;
+	FVector Scale;
+};
+
+static FUnrealSplineSample
+GetSplineSampleAtInputKey(USplineComponent* SplineComponent, const float& InKey)
+{
+	FUnrealSplineSample Sample;
+	Sample.Key = InKey;
+	Sample.Position = SplineComponent->GetLocationAtSplineInputKey(InKey, ESplineCoordinateSpace::Local);
+	Sample.Rotation = SplineComponent->GetQuaternionAtSplineInputKey(InKey, ESplineCoordinateSpace::World);
+	Sample.Scale = SplineComponent->GetScaleAtSplineInputKey(InKey);
+	return Sample;
+}
+
+// Returns true if the spline between Start and End isn't approximated well enough by a line
+static bool
+NeedsSubdivision(USplineComponent* SplineComponent, const FUnrealSplineSample& Start, const FUnrealSplineSample& End)
+{
+	// Check the deviation from the chord at a few points, a single midpoint misses S-shaped sections
+	for (float Alpha : { 0.25f, 0.5f, 0.75f })
+	{
+		float Key = FMath::Lerp(Start.Key, End.Key, Alpha);
+		FVector Position = SplineComponent->GetLocationAtSplineInputKey(Key, ESplineCoordinateSpace::Local);
+		FVector OnChord = FMath::ClosestPointOnSegment(Position, Start.Position, End.Position);
+		if (FVector::DistSquared(Position, OnChord) > FMath::Square(HAPI_UNREAL_SPLINE_SAMPLING_TOLERANCE))
+			return true;
+	}
+
+	// Rotations and scales are also interpolated linearly in Houdini
+	if (FMath::RadiansToDegrees(Start.Rotation.AngularDistance(End.Rotation)) > HAPI_UNREAL_SPLINE_SAMPLING_ANGLE_TOLERANCE)
+		return true;
+
+	if (!Start.Scale.Equals(End.Scale, KINDA_SMALL_NUMBER))
+		return true;
+
+	return false;
+}
+
+void
+FUnrealSplineTranslator::SampleSplineComponent(
+	USplineComponent* SplineComponent, const float& SplineResolution,
+	TArray<FVector>& OutPositions, TArray<FQuat>& OutRotations, TArray<FVector>& OutScales)
 {
+	OutPositions.Empty();
+	OutRotations.Empty();
+	OutScales.Empty();
+
 	if (!SplineComponent || SplineComponent->IsPendingKill())
-		return false;
-	
-	int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
-	float SplineLength = SplineComponent->GetSplineLength();
+		return;
 
-	// Calculate the number of refined point we want
-	int32 NumberOfRefinedSplinePoints = SplineResolution > 0.0f ? ceil(SplineLength / SplineResolution) + 1 : NumberOfControlPoints;
+	int32 NumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+	int32 NumberOfSegments = SplineComponent->GetNumberOfSplineSegments();
+	if (SplineResolution <= 0.0f || NumberOfSegments <= 0)
+	{
+		// No resolution, we'll use the control points instead
+		OutPositions.SetNumZeroed(NumberOfControlPoints);
+		OutRotations.SetNumZeroed(NumberOfControlPoints);
+		OutScales.SetNumZeroed(NumberOfControlPoints);
 
-	TArray<FVector> RefinedSplinePositions;
-	TArray<FQuat> RefinedSplineRotations;
-	TArray<FVector> RefinedSplineScales;
+		for (int32 n = 0; n < NumberOfControlPoints; ++n)
+		{
+			OutPositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
+			OutRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+			OutScales[n] = SplineComponent->GetScaleAtSplinePoint(n);
+		}
+		return;
+	}
 
-	if (NumberOfRefinedSplinePoints <= NumberOfControlPoints) 
+	// Sample each segment independently, every segment's samples include its start but not its end
+	TArray<TArray<FUnrealSplineSample>> SegmentSamples;
+	SegmentSamples.SetNum(NumberOfSegments);
+	ParallelFor(NumberOfSegments, [&](int32 SegmentIdx)
 	{
-		// There's not enough refined points, so we'll use the control points instead
-		RefinedSplinePositions.SetNumZeroed(NumberOfControlPoints);
-		RefinedSplineRotations.SetNumZeroed(NumberOfControlPoints);
-		RefinedSplineScales.SetNumZeroed(NumberOfControlPoints);
+		TArray<FUnrealSplineSample>& Samples = SegmentSamples[SegmentIdx];
 
-		for (int32 n = 0; n < NumberOfControlPoints; ++n) 
+		// Subdivide the segment depth first, so the samples are added in order
+		TArray<TPair<FUnrealSplineSample, int32>> Stack;
+		FUnrealSplineSample SegmentStart = GetSplineSampleAtInputKey(SplineComponent, (float)SegmentIdx);
+		FUnrealSplineSample SegmentEnd = GetSplineSampleAtInputKey(SplineComponent, (float)(SegmentIdx + 1));
+		Samples.Add(SegmentStart);
+		Stack.Add(TPair<FUnrealSplineSample, int32>(SegmentEnd, 0));
+		while (Stack.Num() > 0)
 		{
-			RefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-			RefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
-			RefinedSplineScales[n] = SplineComponent->GetScaleAtSplinePoint(n);
+			const FUnrealSplineSample& Start = Samples.Last();
+			FUnrealSplineSample End = Stack.Last().Key;
+			int32 Depth = Stack.Last().Value;
+
+			// Don't subdivide steps that are already below the sampling resolution
+			bool bSubdivide = Depth < HAPI_UNREAL_SPLINE_SAMPLING_MAX_DEPTH
+				&& FVector::Dist(Start.Position, End.Position) > SplineResolution
+				&& NeedsSubdivision(SplineComponent, Start, End);
+
+			if (bSubdivide)
+			{
+				FUnrealSplineSample Mid = GetSplineSampleAtInputKey(SplineComponent, (Start.Key + End.Key) * 0.5f);
+				Stack.Last().Value = Depth + 1;
+				Stack.Add(TPair<FUnrealSplineSample, int32>(Mid, Depth + 1));
+				continue;
+			}
+
+			Stack.Pop(false);
+			if (Stack.Num() > 0)
+				Samples.Add(End);
+		}
+	});
+
+	int32 NumberOfSamples = 0;
+	for (const TArray<FUnrealSplineSample>& Samples : SegmentSamples)
+		NumberOfSamples += Samples.Num();
+
+	// Closed splines are sent as periodic curves, so their last point isn't needed
+	bool bAddLastPoint = !SplineComponent->IsClosedLoop();
+	if (bAddLastPoint)
+		NumberOfSamples++;
+
+	OutPositions.Reserve(NumberOfSamples);
+	OutRotations.Reserve(NumberOfSamples);
+	OutScales.Reserve(NumberOfSamples);
+	for (const TArray<FUnrealSplineSample>& Samples : SegmentSamples)
+	{
+		for (const FUnrealSplineSample& Sample : Samples)
+		{
+			OutPositions.Add(Sample.Position);
+			OutRotations.Add(Sample.Rotation);
+			OutScales.Add(Sample.Scale);
 		}
 	}
-	else 
+
+	if (bAddLastPoint)
 	{
-		// Calculate the refined spline component
-		RefinedSplinePositions.SetNumZeroed(NumberOfRefinedSplinePoints);
-		RefinedSplineRotations.SetNumZeroed(NumberOfRefinedSplinePoints);
-		RefinedSplineScales.SetNumZeroed(NumberOfRefinedSplinePoints);
+		FUnrealSplineSample LastSample = GetSplineSampleAtInputKey(SplineComponent, (float)NumberOfSegments);
+		OutPositions.Add(LastSample.Position);
+		OutRotations.Add(LastSample.Rotation);
+		OutScales.Add(LastSample.Scale);
+	}
+}
+
+uint32
+FUnrealSplineTranslator::GetSplineComponentHash(USplineComponent* SplineComponent, const float& SplineResolution)
+{
+	if (!SplineComponent || SplineComponent->IsPendingKill())
+		return 0;
+
+	// Hash each member separately, as the curve points' padding isn't initialized
+	uint32 Hash = FCrc::MemCrc32(&SplineResolution, sizeof(float));
+	bool bClosed = SplineComponent->IsClosedLoop();
+	Hash = FCrc::MemCrc32(&bClosed, sizeof(bool), Hash);
+
+	// Rotations are sampled in world space
+	FTransform ComponentTransform = SplineComponent->GetComponentTransform();
+	FVector Location = ComponentTransform.GetLocation();
+	FQuat Rotation = ComponentTransform.GetRotation();
+	FVector Scale = ComponentTransform.GetScale3D();
+	Hash = FCrc::MemCrc32(&Location, sizeof(FVector), Hash);
+	Hash = FCrc::MemCrc32(&Rotation, sizeof(FQuat), Hash);
+	Hash = FCrc::MemCrc32(&Scale, sizeof(FVector), Hash);
 
-		float CurrentDistance = 0.0f;
-		for (int32 n = 0; n < NumberOfRefinedSplinePoints; ++n) 
+	auto HashCurve = [&Hash](const auto& InCurve)
+	{
+		for (const auto& Point : InCurve.Points)
 		{
-			RefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(CurrentDistance, ESplineCoordinateSpace::Local);
-			RefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(CurrentDistance, ESplineCoordinateSpace::World);
-			RefinedSplineScales[n] = SplineComponent->GetScaleAtDistanceAlongSpline(CurrentDistance);
+			uint8 InterpMode = Point.InterpMode;
+			Hash = FCrc::MemCrc32(&Point.InVal, sizeof(Point.InVal), Hash);
+			Hash = FCrc::MemCrc32(&Point.OutVal, sizeof(Point.OutVal), Hash);
+			Hash = FCrc::MemCrc32(&Point.ArriveTangent, sizeof(Point.ArriveTangent), Hash);
+			Hash = FCrc::MemCrc32(&Point.LeaveTangent, sizeof(Point.LeaveTangent), Hash);
+			Hash = FCrc::MemCrc32(&InterpMode, sizeof(uint8), Hash);
+		}
+	};
 
-			CurrentDistance += SplineResolution;
-		}			
+	const FSplineCurves& SplineCurves = SplineComponent->SplineCurves;
+	HashCurve(SplineCurves.Position);
+	HashCurve(SplineCurves.Rotation);
+	HashCurve(SplineCurves.Scale);
+
+	return Hash;
+}
+
+bool
+FUnrealSplineTranslator::CreateInputNodeForSplineComponent(
+	USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId& CreatedInputNodeId, const FString& NodeName,
+	UHoudiniInputSplineComponent* InInputSpline)
+{
+	if (!SplineComponent || SplineComponent->IsPendingKill())
+		return false;
+
+	TArray<FVector> RefinedSplinePositions;
+	TArray<FQuat> RefinedSplineRotations;
+	TArray<FVector> RefinedSplineScales;
+
+	// Reuse the cached samples if the spline hasn't changed since it was last sampled
+	uint32 SplineHash = GetSplineComponentHash(SplineComponent, SplineResolution);
+	if (InInputSpline && InInputSpline->CachedSampleHash == SplineHash && InInputSpline->CachedSamplePositions.Num() > 0)
+	{
+		RefinedSplinePositions = InInputSpline->CachedSamplePositions;
+		RefinedSplineRotations = InInputSpline->CachedSampleRotations;
+		RefinedSplineScales = InInputSpline->CachedSampleScales;
 	}
+	else
+	{
+		SampleSplineComponent(SplineComponent, SplineResolution, RefinedSplinePositions, RefinedSplineRotations, RefinedSplineScales);
 
+		if (InInputSpline)
+		{
+			InInputSpline->CachedSampleHash = SplineHash;
+			InInputSpline->CachedSamplePositions = RefinedSplinePositions;
+			InInputSpline->CachedSampleRotations = RefinedSplineRotations;
+			InInputSpline->CachedSampleScales = RefinedSplineScales;
+		}
+	}
 
-	if (!FHoudiniSplineTranslator::HapiCreateCurveInputNodeForData(CreatedInputNodeId, NodeName,
-		&RefinedSplinePositions, &RefinedSplineRotations, &RefinedSplineScales,
-		EHoudiniCurveType::Polygon, EHoudiniCurveMethod::Breakpoints, false, SplineComponent->IsClosedLoop()))
+	// Unreal splines are sent as linear curves, so we don't need a curve SOP for them
+	if (!FHoudiniSplineTranslator::HapiCreateLinearCurveInputNodeForData(CreatedInputNodeId, NodeName,
+		RefinedSplinePositions, &RefinedSplineRotations, &RefinedSplineScales, SplineComponent->IsClosedLoop()))
 		return false;
 
 	// Add spline component tags if it has any
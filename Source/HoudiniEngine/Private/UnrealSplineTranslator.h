@@ -30,10 +30,22 @@
 #include "UObject/NameTypes.h"
 
 class USplineComponent;
+class UHoudiniInputSplineComponent;
 
 struct HOUDINIENGINE_API FUnrealSplineTranslator 
 {
 public:
-	static bool CreateInputNodeForSplineComponent(USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId &CreatedInputNodeId, const FString& NodeName);
+	// If InInputSpline is valid, the sampled points are cached on it and reused while the spline is unchanged
+	static bool CreateInputNodeForSplineComponent(
+		USplineComponent* SplineComponent, const float& SplineResolution, HAPI_NodeId &CreatedInputNodeId, const FString& NodeName,
+		UHoudiniInputSplineComponent* InInputSpline = nullptr);
 
+	// Samples the spline adaptively: each segment is subdivided until it is within tolerance of the spline,
+	// but never into steps shorter than SplineResolution. Segments are sampled in parallel.
+	static void SampleSplineComponent(
+		USplineComponent* SplineComponent, const float& SplineResolution,
+		TArray<FVector>& OutPositions, TArray<FQuat>& OutRotations, TArray<FVector>& OutScales);
+
+	// Returns a hash of the spline's control points, closed state, transform and sampling resolution
+	static uint32 GetSplineComponentHash(USplineComponent* SplineComponent, const float& SplineResolution);
 };
\ No newline at end of file
@@ -245,6 +245,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToActors(
 	if (!IsValid(OwnerActor))
 		return false;
 
+	// Bake the generated materials, not the placeholder used while they compile
+	FHoudiniEngine::Get().ReleaseCompilingMaterials(HoudiniAssetComponent);
+
 	const FString HoudiniAssetName = OwnerActor->GetName();
 
 	// Get an array of the outputs
@@ -480,6 +483,9 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent* Houdi
 	if (!OwnerActor || OwnerActor->IsPendingKill())
 		return false;
 
+	// Bake the generated materials, not the placeholder used while they compile
+	FHoudiniEngine::Get().ReleaseCompilingMaterials(HoudiniAssetComponent);
+
 	ULevel* DesiredLevel = GWorld->GetCurrentLevel();
 	
 	AInstancedFoliageActor* InstancedFoliageActor = AInstancedFoliageActor::GetInstancedFoliageActorForLevel(DesiredLevel, true);
@@ -534,6 +540,11 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent* Houdi
 			// 	InstanceName = OutputObj->BakeName;
 
 			FHoudiniInstancedOutput& InstancedOutput = Pair.Value;
+
+			// Apply the transform offsets on the transforms of all the variations
+			TArray<TArray<FTransform>> AllProcessedTransforms;
+			FHoudiniInstanceTranslator::ProcessInstanceTransforms(InstancedOutput, AllProcessedTransforms);
+
 			for (int32 VariarionIdx = 0; VariarionIdx < InstancedOutput.VariationObjects.Num(); ++VariarionIdx)
 			{
 				// TODO: !!! what if the instanced object/var is not a static mesh!!!!!!
@@ -636,9 +647,8 @@ FHoudiniEngineBakeUtils::BakeHoudiniActorToFoliage(UHoudiniAssetComponent* Houdi
 				if (!FoliageInfo)
 					continue;
 
-				// Apply the transform offset on the transforms for this variation
-				TArray<FTransform> ProcessedTransforms;
-				FHoudiniInstanceTranslator::ProcessInstanceTransforms(InstancedOutput, VariarionIdx, ProcessedTransforms);
+				// Get the transforms for this variation
+				const TArray<FTransform>& ProcessedTransforms = AllProcessedTransforms[VariarionIdx];
 
 				FFoliageInstance FoliageInstance;
 				int32 CurrentInstanceCount = 0;
@@ -1419,6 +1429,9 @@ FHoudiniEngineBakeUtils::BakeInstancerOutputToActors_IAC(
 		}
 	}
 
+	// Make sure all the instances have been spawned before baking them
+	FHoudiniInstanceTranslator::SpawnPendingInstancedActors(InIAC, 0.0);
+
 	// Empty and reserve enough space for new instanced actors
 	InBakedOutputObject.InstancedActors.Empty(InIAC->GetInstancedActors().Num());
 
@@ -2200,6 +2213,9 @@ FHoudiniEngineBakeUtils::BakeBlueprints(
 	if (!HoudiniAssetComponent || HoudiniAssetComponent->IsPendingKill())
 		return false;
 
+	// Bake the generated materials, not the placeholder used while they compile
+	FHoudiniEngine::Get().ReleaseCompilingMaterials(HoudiniAssetComponent);
+
 	AActor* OwnerActor = HoudiniAssetComponent->GetOwner();
 	const bool bIsOwnerActorValid = IsValid(OwnerActor);
 	
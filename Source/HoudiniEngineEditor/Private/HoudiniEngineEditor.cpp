@@ -1267,6 +1267,9 @@ FHoudiniEngineEditor::RegisterEditorDelegates()
 {
 	PreSaveWorldEditorDelegateHandle = FEditorDelegates::PreSaveWorld.AddLambda([](uint32 SaveFlags, UWorld* World)
 	{
+		// Don't save the placeholder materials of outputs whose materials are still compiling
+		FHoudiniEngine::Get().ReleaseCompilingMaterials(nullptr);
+
 		// Skip if this is a game world or an autosave, only refine meshes when the user manually saves
 		if (!World->IsGameWorld() && (SaveFlags & ESaveFlags::SAVE_FromAutosave) == 0)
 		{
@@ -29,6 +29,7 @@
 #include "HoudiniRuntimeSettings.h"
 
 #include "HoudiniAssetComponent.h"
+#include "HoudiniGenericAttribute.h"
 
 #include "Modules/ModuleManager.h"
 
@@ -65,6 +66,16 @@ void FHoudiniEngineRuntime::StartupModule()
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
 	// Store the instance.
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = this;
+
+#if WITH_EDITOR
+	// Blueprint compilation and hot reload replace the properties of the reinstanced classes,
+	// the cached property paths would point to deleted properties.
+	OnObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda(
+		[](const TMap<UObject*, UObject*>& InReplacedObjects)
+		{
+			FHoudiniGenericAttribute::ResetPropertyPathCache();
+		});
+#endif
 }
 
 
@@ -72,6 +83,12 @@ void FHoudiniEngineRuntime::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+#if WITH_EDITOR
+	if (OnObjectsReplacedHandle.IsValid())
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(OnObjectsReplacedHandle);
+#endif
+	FHoudiniGenericAttribute::ResetPropertyPathCache();
+
 	FHoudiniEngineRuntime::HoudiniEngineRuntimeInstance = nullptr;
 }
 
@@ -104,4 +104,7 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngineRuntime : public IModuleInterface
 		TArray<int32> NodeIdsPendingDelete;
 
 		TArray<int32> NodeIdsParentPendingDelete;
+
+		// Handle to the delegate invalidating the cached property paths when classes are recompiled
+		FDelegateHandle OnObjectsReplacedHandle;
 };
\ No newline at end of file
@@ -116,12 +116,16 @@ HOUDINIENGINEEDITOR_API DECLARE_LOG_CATEGORY_EXTERN(LogHoudiniEngineEditor, Log,
 
 	#define HOUDINI_LOG_DISPLAY( HOUDINI_LOG_TEXT, ... ) \
 			HOUDINI_LOG_HELPER( Display, HOUDINI_LOG_TEXT, ##__VA_ARGS__ )
+
+	#define HOUDINI_LOG_VERBOSE( HOUDINI_LOG_TEXT, ... ) \
+			HOUDINI_LOG_HELPER( Verbose, HOUDINI_LOG_TEXT, ##__VA_ARGS__ )
 #else
 	#define HOUDINI_LOG_MESSAGE( HOUDINI_LOG_TEXT, ... )
 	#define HOUDINI_LOG_FATAL( HOUDINI_LOG_TEXT, ... )
 	#define HOUDINI_LOG_ERROR( HOUDINI_LOG_TEXT, ... )
 	#define HOUDINI_LOG_WARNING( HOUDINI_LOG_TEXT, ... )
 	#define HOUDINI_LOG_DISPLAY( HOUDINI_LOG_TEXT, ... )
+	#define HOUDINI_LOG_VERBOSE( HOUDINI_LOG_TEXT, ... )
 #endif
 
 // HOUDINI_ENGINE_DEBUG_BP: blueprint related debug logging
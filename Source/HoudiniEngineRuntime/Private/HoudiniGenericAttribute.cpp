@@ -37,6 +37,68 @@
 #include "EditorFramework/AssetImportData.h"
 #include "AI/Navigation/NavCollisionBase.h"
 
+// A property resolved on a class: the struct properties leading to its container, and the property itself
+struct FHoudiniPropertyPath
+{
+	TArray<FStructProperty*> StructPath;
+	FProperty* Property = nullptr;
+};
+
+// Resolved property paths per class and property name, a null property means the class doesn't have it
+static TMap<TPair<TWeakObjectPtr<UClass>, FString>, FHoudiniPropertyPath> PropertyPathCache;
+
+#if WITH_EDITOR
+// Recursive search for a given property on a struct, records the struct properties leading to the found property
+// instead of its container, so the result can be reused on any object of the same class
+static void
+TryToFindPropertyPath(
+	UStruct* InStruct,
+	const FString& InPropertyName,
+	TArray<FStructProperty*>& InCurrentPath,
+	FHoudiniPropertyPath& OutPropertyPath,
+	bool& bOutPropertyHasBeenFound)
+{
+	if (!InStruct || InStruct->IsPendingKill())
+		return;
+
+	for (TFieldIterator<FProperty> PropIt(InStruct, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+	{
+		FProperty* CurrentProperty = *PropIt;
+		if (!CurrentProperty)
+			continue;
+
+		FString DisplayName = CurrentProperty->GetDisplayNameText().ToString().Replace(TEXT(" "), TEXT(""));
+		FString Name = CurrentProperty->GetName();
+
+		// If the property name contains the uprop attribute name, we have a candidate
+		if (Name.Contains(InPropertyName) || DisplayName.Contains(InPropertyName))
+		{
+			OutPropertyPath.Property = CurrentProperty;
+			OutPropertyPath.StructPath = InCurrentPath;
+
+			// If it's an equality, we dont need to keep searching anymore
+			if ((Name == InPropertyName) || (DisplayName == InPropertyName))
+			{
+				bOutPropertyHasBeenFound = true;
+				break;
+			}
+		}
+
+		// Do a recursive parsing for StructProperties
+		FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty);
+		if (StructProperty)
+		{
+			InCurrentPath.Add(StructProperty);
+			TryToFindPropertyPath(StructProperty->Struct, InPropertyName, InCurrentPath, OutPropertyPath, bOutPropertyHasBeenFound);
+			InCurrentPath.Pop(false);
+		}
+
+		if (bOutPropertyHasBeenFound)
+			break;
+	}
+}
+#endif
+
 double
 FHoudiniGenericAttribute::GetDoubleValue(int32 index) const
 {
@@ -271,14 +333,9 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 	OutFoundProperty = nullptr;
 	OutFoundPropertyObject = InObject;
 
-	bool bPropertyHasBeenFound = false;
-	FHoudiniGenericAttribute::TryToFindProperty(
-		InObject,
-		ObjectClass,
-		InPropertyName,
-		OutFoundProperty,
-		bPropertyHasBeenFound,
-		OutContainer);
+	// Look for the property on the object's class first
+	if (FindPropertyOnClass(InObject, InPropertyName, OutFoundProperty, OutContainer))
+		return true;
 
 	/*
 	// TODO: Parsing needs to be made recursively!
@@ -355,18 +412,6 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 		return true;
 	*/
 
-	// Try with FindField??
-	if (!OutFoundProperty)
-		OutFoundProperty = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
-
-	// Try with FindPropertyByName ??
-	if (!OutFoundProperty)
-		OutFoundProperty = ObjectClass->FindPropertyByName(*InPropertyName);
-
-	// We found the Property we were looking for
-	if (OutFoundProperty)
-		return true;
-
 	// Handle common properties nested in classes
 	// Static Meshes
 	UStaticMesh* SM = Cast<UStaticMesh>(InObject);
@@ -422,86 +467,72 @@ FHoudiniGenericAttribute::FindPropertyOnObject(
 
 
 bool
-FHoudiniGenericAttribute::TryToFindProperty(
-	void* InContainer,
-	UStruct* InStruct,
+FHoudiniGenericAttribute::FindPropertyOnClass(
+	UObject* InObject,
 	const FString& InPropertyName,
 	FProperty*& OutFoundProperty,
-	bool& bOutPropertyHasBeenFound,
 	void*& OutContainer)
 {
 #if WITH_EDITOR
-	if (!InContainer)
-		return false;
-	
-	if (!InStruct || InStruct->IsPendingKill())
+	OutFoundProperty = nullptr;
+	OutContainer = nullptr;
+
+	if (!InObject || InObject->IsPendingKill() || InPropertyName.IsEmpty())
 		return false;
 
-	if (InPropertyName.IsEmpty())
+	UClass* ObjectClass = InObject->GetClass();
+	if (!ObjectClass || ObjectClass->IsPendingKill())
 		return false;
 
-	// Iterate manually on the properties, in order to handle StructProperties correctly
-	for (TFieldIterator<FProperty> PropIt(InStruct, EFieldIteratorFlags::IncludeSuper); PropIt; ++PropIt)
+	// Resolve the property path on the class if we haven't already
+	const TPair<TWeakObjectPtr<UClass>, FString> CacheKey(ObjectClass, InPropertyName);
+	FHoudiniPropertyPath* PropertyPath = PropertyPathCache.Find(CacheKey);
+	if (!PropertyPath)
 	{
-		FProperty* CurrentProperty = *PropIt;
-		if (!CurrentProperty)
-			continue;
+		FHoudiniPropertyPath NewPropertyPath;
+		TArray<FStructProperty*> CurrentPath;
+		bool bPropertyHasBeenFound = false;
+		TryToFindPropertyPath(ObjectClass, InPropertyName, CurrentPath, NewPropertyPath, bPropertyHasBeenFound);
 
-		FString DisplayName = CurrentProperty->GetDisplayNameText().ToString().Replace(TEXT(" "), TEXT(""));
-		FString Name = CurrentProperty->GetName();
+		// Try with FindField??
+		if (!NewPropertyPath.Property)
+			NewPropertyPath.Property = FindFProperty<FProperty>(ObjectClass, *InPropertyName);
 
-		// If the property name contains the uprop attribute name, we have a candidate
-		if (Name.Contains(InPropertyName) || DisplayName.Contains(InPropertyName))
-		{
-			OutFoundProperty = CurrentProperty;
-			OutContainer = InContainer;
+		// Try with FindPropertyByName ??
+		if (!NewPropertyPath.Property)
+			NewPropertyPath.Property = ObjectClass->FindPropertyByName(*InPropertyName);
 
-			// If it's an equality, we dont need to keep searching anymore
-			if ((Name == InPropertyName) || (DisplayName == InPropertyName))
-			{
-				bOutPropertyHasBeenFound = true;
-				break;
-			}
-		}
-
-		// Do a recursive parsing for StructProperties
-		FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty);
-		if (StructProperty)
-		{
-			// Walk the structs' properties and try to find the one we're looking for
-			UScriptStruct* Struct = StructProperty->Struct;
-			if (!Struct || Struct->IsPendingKill())
-				continue;
-
-			TryToFindProperty(
-				StructProperty->ContainerPtrToValuePtr<void>(InContainer, 0),
-				Struct,
-				InPropertyName,
-				OutFoundProperty,
-				bOutPropertyHasBeenFound,
-				OutContainer);
-		}
-
-		if (bOutPropertyHasBeenFound)
-			break;
+		PropertyPath = &PropertyPathCache.Add(CacheKey, MoveTemp(NewPropertyPath));
 	}
 
-	if (bOutPropertyHasBeenFound)
-		return true;
+	if (!PropertyPath->Property)
+		return false;
 
-	// We found the Property we were looking for
-	if (OutFoundProperty)
-		return true;
+	// Walk the struct properties to get the property's container on this object
+	void* Container = InObject;
+	for (FStructProperty* StructProperty : PropertyPath->StructPath)
+		Container = StructProperty->ContainerPtrToValuePtr<void>(Container, 0);
 
-#endif
+	OutFoundProperty = PropertyPath->Property;
+	OutContainer = Container;
+	return true;
+#else
 	return false;
+#endif
+}
+
+
+void
+FHoudiniGenericAttribute::ResetPropertyPathCache()
+{
+	PropertyPathCache.Empty();
 }
 
 
 bool
 FHoudiniGenericAttribute::ModifyPropertyValueOnObject(
 	UObject* InObject,
-	FHoudiniGenericAttribute InGenericAttribute,
+	const FHoudiniGenericAttribute& InGenericAttribute,
 	FProperty* FoundProperty,
 	void* InContainer,
 	const int32& InAtIndex)
@@ -517,21 +548,12 @@ FHoudiniGenericAttribute::ModifyPropertyValueOnObject(
 
 	AActor* InOwner = Cast<AActor>(InObject->GetOuter());
 	bool bHasModifiedProperty = false;
-	
 
-	auto OnPropertyChanged = [InObject, InOwner, &bHasModifiedProperty](FProperty* InProperty)
+	// The change notifications are sent once all the values of the property have been set
+	FProperty* ModifiedProperty = nullptr;
+	auto OnPropertyChanged = [&ModifiedProperty, &bHasModifiedProperty](FProperty* InProperty)
 	{
-#if WITH_EDITOR
-		FPropertyChangedEvent Evt(InProperty);
-		InObject->PostEditChangeProperty(Evt);
-		if (InOwner)
-		{
-			// If we are setting properties on an Actor component, we want to notify the
-			// actor of the changes too since the property change might be handled in the actor's
-			// PostEditChange callbacks (one such an example occurs when changing the material for a decal actor).
-			InOwner->PostEditChangeProperty(Evt);
-		}
-#endif
+		ModifiedProperty = InProperty;
 		bHasModifiedProperty = true;
 	};
 
@@ -978,6 +1000,16 @@ FHoudiniGenericAttribute::ModifyPropertyValueOnObject(
 	if (bHasModifiedProperty)
 	{
 #if WITH_EDITOR
+		FPropertyChangedEvent Evt(ModifiedProperty);
+		InObject->PostEditChangeProperty(Evt);
+		if (InOwner)
+		{
+			// If we are setting properties on an Actor component, we want to notify the
+			// actor of the changes too since the property change might be handled in the actor's
+			// PostEditChange callbacks (one such an example occurs when changing the material for a decal actor).
+			InOwner->PostEditChangeProperty(Evt);
+		}
+
 		InObject->PostEditChange();
 		if (InOwner)
 		{
@@ -104,20 +104,22 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGenericAttribute
 		UObject*& OutFoundPropertyObject,
 		void*& OutContainer);
 
+	// Finds a property on InObject's class (including nested struct properties) and returns its container.
+	// The resolved property path is cached per class and property name, so the reflection data is only walked once.
+	static bool FindPropertyOnClass(
+		UObject* InObject,
+		const FString& InPropertyName,
+		FProperty*& OutFoundProperty,
+		void*& OutContainer);
+
+	// Empties the cache of resolved property paths
+	static void ResetPropertyPathCache();
+
 	// Modifies the value of a found Property
 	static bool ModifyPropertyValueOnObject(
 		UObject* InObject,
-		FHoudiniGenericAttribute InGenericAttribute,
+		const FHoudiniGenericAttribute& InGenericAttribute,
 		FProperty* FoundProperty,
 		void* InContainer,
 		const int32& AtIndex = 0 );
-
-	// Recursive search for a given property on a UObject
-	static bool TryToFindProperty(
-		void* InContainer,
-		UStruct* InStruct,
-		const FString& InPropertyName,
-		FProperty*& OutFoundProperty,
-		bool& bOutPropertyHasBeenFound,
-		void*& OutContainer);
 };
\ No newline at end of file
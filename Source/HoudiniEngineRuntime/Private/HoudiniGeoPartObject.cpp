@@ -27,6 +27,72 @@
 #include "HoudiniGeoPartObject.h"
 
 //
+void
+FHoudiniAttributeManifest::Reset()
+{
+	bIsValid = false;
+	for (int32 OwnerIdx = 0; OwnerIdx < NumOwners; OwnerIdx++)
+		AttributeNames[OwnerIdx].Empty();
+}
+
+bool
+FHoudiniAttributeManifest::HasAttribute(const FString& InAttributeName, const int32& InOwner) const
+{
+	if (InOwner < 0)
+		return FindAttributeOwner(InAttributeName) >= 0;
+
+	if (InOwner >= NumOwners)
+		return false;
+
+	return AttributeNames[InOwner].Contains(InAttributeName);
+}
+
+int32
+FHoudiniAttributeManifest::FindAttributeOwner(const FString& InAttributeName) const
+{
+	for (int32 OwnerIdx = 0; OwnerIdx < NumOwners; OwnerIdx++)
+	{
+		if (AttributeNames[OwnerIdx].Contains(InAttributeName))
+			return OwnerIdx;
+	}
+
+	return -1;
+}
+
+bool
+FHoudiniAttributeManifest::HasSameAttributes(const FHoudiniAttributeManifest& InOther) const
+{
+	if (bIsValid != InOther.bIsValid)
+		return false;
+
+	for (int32 OwnerIdx = 0; OwnerIdx < NumOwners; OwnerIdx++)
+	{
+		if (AttributeNames[OwnerIdx].Num() != InOther.AttributeNames[OwnerIdx].Num())
+			return false;
+
+		if (!AttributeNames[OwnerIdx].Includes(InOther.AttributeNames[OwnerIdx]))
+			return false;
+	}
+
+	return true;
+}
+
+bool
+FHoudiniAttributeManifest::HaveSameAttributes(
+	const TSharedPtr<const FHoudiniAttributeManifest>& InManifestA,
+	const TSharedPtr<const FHoudiniAttributeManifest>& InManifestB)
+{
+	if (InManifestA == InManifestB)
+		return true;
+
+	const bool bIsValidA = InManifestA.IsValid() && InManifestA->bIsValid;
+	const bool bIsValidB = InManifestB.IsValid() && InManifestB->bIsValid;
+	if (!bIsValidA || !bIsValidB)
+		return bIsValidA == bIsValidB;
+
+	return InManifestA->HasSameAttributes(*InManifestB);
+}
+
 FHoudiniGeoPartObject::FHoudiniGeoPartObject()
 	: AssetId(-1)
 	, AssetName(TEXT(""))
@@ -123,6 +189,30 @@ FHoudiniGeoPartObject::Equals(const FHoudiniGeoPartObject & GeoPartObject, const
 	return false;
 }
 
+uint32
+FHoudiniGeoPartObject::GetIdIdentityHash() const
+{
+	int32 HashBuffer[4] = { ObjectId, GeoId, PartId, (int32)Type };
+	return FCrc::MemCrc32((void *)&HashBuffer[0], sizeof(HashBuffer));
+}
+
+uint32
+FHoudiniGeoPartObject::GetNameIdentityHash() const
+{
+	// Matches CompareNames(), the type must also match
+	int32 TypeValue = (int32)Type;
+	uint32 Hash = FCrc::MemCrc32((void *)&TypeValue, sizeof(TypeValue));
+	Hash = FCrc::StrCrc32(*ObjectName, Hash);
+	return FCrc::StrCrc32(*PartName, Hash);
+}
+
+uint32
+FHoudiniGeoPartObject::GetHeightfieldIdentityHash() const
+{
+	int32 HashBuffer[4] = { AssetId, ObjectId, GeoId, VolumeTileIndex };
+	return FCrc::MemCrc32((void *)&HashBuffer[0], sizeof(HashBuffer));
+}
+
 void 
 FHoudiniGeoPartObject::SetCustomPartName(const FString & InName) 
 {
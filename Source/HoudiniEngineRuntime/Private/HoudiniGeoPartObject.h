@@ -265,6 +265,42 @@ struct HOUDINIENGINERUNTIME_API FHoudiniSplitDataCache
 */
 
 
+// Case sensitive string keys, Houdini attribute names are case sensitive
+struct FHoudiniCaseSensitiveStringKeyFuncs : BaseKeyFuncs<FString, FString, false>
+{
+	static const FString& GetSetKey(const FString& Element) { return Element; }
+	static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+	static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32<TCHAR>(*Key); }
+};
+
+// Names of all the attributes of a part for each owner, in HAPI_AttributeOwner order (vertex, point, prim, detail).
+// Gathered once per cook so attribute existence and owner checks don't need to query HAPI.
+struct HOUDINIENGINERUNTIME_API FHoudiniAttributeManifest
+{
+	static const int32 NumOwners = 4;
+
+	void Reset();
+
+	// Returns true if the attribute exists on the given owner, or on any owner if InOwner is negative
+	bool HasAttribute(const FString& InAttributeName, const int32& InOwner = -1) const;
+
+	// Returns the first owner that has the attribute, or -1 if none has it
+	int32 FindAttributeOwner(const FString& InAttributeName) const;
+
+	// Returns true if both manifests contain the same attributes on the same owners
+	bool HasSameAttributes(const FHoudiniAttributeManifest& InOther) const;
+
+	// Same as above, for shared manifests. Missing manifests are treated as invalid ones.
+	static bool HaveSameAttributes(
+		const TSharedPtr<const FHoudiniAttributeManifest>& InManifestA,
+		const TSharedPtr<const FHoudiniAttributeManifest>& InManifestB);
+
+	// Indicates the manifest has been gathered
+	bool bIsValid = false;
+
+	TSet<FString, FHoudiniCaseSensitiveStringKeyFuncs> AttributeNames[NumOwners];
+};
+
 USTRUCT()
 struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
 {
@@ -288,6 +324,13 @@ public:
 
 	void SetCustomPartName(const FString & InName);
 
+	// Identity hashes, used to match HGPOs across cooks without a linear search.
+	// Two HGPOs that are Equals() always share their ID or their name hash (unless one of them is loaded).
+	uint32 GetIdIdentityHash() const;
+	uint32 GetNameIdentityHash() const;
+	// Hash shared by all the volumes of a heightfield tile
+	uint32 GetHeightfieldIdentityHash() const;
+
 	static FString HoudiniPartTypeToString(const EHoudiniPartType& InType);
 
 public:
@@ -414,6 +457,10 @@ public:
 	// CurveInfo cache
 	FHoudiniCurveInfo CurveInfo;
 
+	// Attribute names of this part, only valid for the cook it was gathered on.
+	// Shared by all the HGPOs of the part.
+	TSharedPtr<const FHoudiniAttributeManifest> AttributeManifest;
+
 	// Cache of this HGPO split data
 	//TArray<FHoudiniSplitDataCache> SplitCache;
 };
\ No newline at end of file
@@ -218,6 +218,7 @@ UHoudiniInputLandscape::UHoudiniInputLandscape(const FObjectInitializer& ObjectI
 //
 UHoudiniInputBrush::UHoudiniInputBrush()
 	: CombinedModel(nullptr)
+	, CombinedModelHash(0)
 	, bIgnoreInputObject(false)
 {
 
@@ -1022,6 +1023,27 @@ UHoudiniInputInstancedMeshComponent::HasComponentTransformChanged() const
 	return HasInstancesChanged();
 }
 
+bool
+UHoudiniInputInstancedMeshComponent::HasInstanceCountChanged() const
+{
+	UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>(InputObject.LoadSynchronous());
+	if (!ISMC)
+		return false;
+
+	return InstanceTransforms.Num() != ISMC->GetInstanceCount();
+}
+
+bool
+UHoudiniInputInstancedMeshComponent::HasComponentChanged() const
+{
+	if (Super::HasComponentChanged())
+		return true;
+
+	// Added/removed instances require a full rebuild of the instancer,
+	// moved instances are only uploaded via the transform update
+	return HasInstanceCountChanged();
+}
+
 void
 UHoudiniInputSplineComponent::Update(UObject * InObject)
 {
@@ -1406,6 +1428,24 @@ bool FHoudiniBrushInfo::HasChanged() const
 	return false;
 }
 
+uint64 FHoudiniBrushInfo::GetHash() const
+{
+	uint64 Hash = 0;
+	HashCombine(Hash, (uint64)(BrushActor.Get()));
+	HashCombine(Hash, CachedTransform.GetLocation());
+	HashCombine(Hash, CachedTransform.GetScale3D());
+	const FQuat Rotation = CachedTransform.GetRotation();
+	HashCombine(Hash, Rotation.X);
+	HashCombine(Hash, Rotation.Y);
+	HashCombine(Hash, Rotation.Z);
+	HashCombine(Hash, Rotation.W);
+	HashCombine(Hash, CachedOrigin);
+	HashCombine(Hash, CachedExtent);
+	HashCombine(Hash, (uint64)(CachedBrushType.GetValue()));
+	HashCombine(Hash, CachedSurfaceHash);
+	return Hash;
+}
+
 int32 FHoudiniBrushInfo::GetNumVertexIndicesFromModel(const UModel* Model)
 {
 	const TArray<FBspNode>& Nodes = Model->Nodes;		
@@ -1450,7 +1490,19 @@ bool UHoudiniInputBrush::HasBrushesChanged(const TArray<ABrush*>& InBrushes) con
 	return false;
 }
 
-void UHoudiniInputBrush::UpdateCachedData(UModel* InCombinedModel, const TArray<ABrush*>& InBrushes)
+uint64 UHoudiniInputBrush::GetBrushesHash(const TArray<ABrush*>& InBrushes)
+{
+	// The order of the brushes matters for the CSG operations, so it is part of the hash
+	uint64 Hash = 0;
+	for (ABrush* Brush : InBrushes)
+	{
+		FHoudiniBrushInfo BrushInfo(Brush);
+		BrushInfo.HashCombine(Hash, BrushInfo.GetHash());
+	}
+	return Hash;
+}
+
+void UHoudiniInputBrush::UpdateCachedData(UModel* InCombinedModel, const TArray<ABrush*>& InBrushes, const uint64& InCombinedModelHash)
 {
 	ABrush* InputBrush = GetBrush();
 	if (IsValid(InputBrush))
@@ -1460,6 +1512,7 @@ void UHoudiniInputBrush::UpdateCachedData(UModel* InCombinedModel, const TArray<
 
 	// Cache the combined model aswell as the brushes used to generate this model.
 	CombinedModel = InCombinedModel;
+	CombinedModelHash = InCombinedModelHash;
 
 	BrushesInfo.SetNumUninitialized(InBrushes.Num());
 	for (int i = 0; i < InBrushes.Num(); ++i)
@@ -370,14 +370,25 @@ public:
 	// Returns true if the instances have changed
 	bool HasInstancesChanged() const;
 
+	// Returns true if instances were added or removed, requiring the instancer input to be rebuilt
+	bool HasInstanceCountChanged() const;
+
 	// Returns true if the attached component's transform has been modified
 	virtual bool HasComponentTransformChanged() const override;
+
+	// Return true if the ISMC's static mesh or instance count have been modified
+	virtual bool HasComponentChanged() const override;
 	
 public:
 
 	// Array of transform for this ISMC's instances
 	UPROPERTY()
-	TArray<FTransform> InstanceTransforms;	
+	TArray<FTransform> InstanceTransforms;
+
+	// Hashes of the chunks of instances uploaded to the instancer input node
+	// Used to only upload the instances that have changed since the last upload
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TArray<uint32> InstanceChunkHashes;
 };
 
 
@@ -435,6 +446,20 @@ public:
 	// Transforms of each of the spline's control points
 	UPROPERTY()
 	TArray<FTransform> SplineControlPoints;
+
+	// Hash of the spline used to generate the cached samples
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	uint32 CachedSampleHash = 0;
+
+	// Points sampled on the spline the last time it was uploaded
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TArray<FVector> CachedSamplePositions;
+
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TArray<FQuat> CachedSampleRotations;
+
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TArray<FVector> CachedSampleScales;
 };
 
 
@@ -620,6 +645,27 @@ public:
 	// Used to restore an input landscape's transform to its original state
 	UPROPERTY()
 	FTransform CachedInputLandscapeTraqnsform;
+
+	// Hash of the heightfield data of each landscape component (keyed by section base) as last uploaded.
+	// Used to only upload the components that have changed.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TMap<FIntPoint, uint32> CachedComponentHashes;
+
+	// NodeIds of the heightfield's volumes, keyed by volume/layer name
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	TMap<FString, int32> CachedVolumeNodeIds;
+
+	// Extents of the landscape data sent to the heightfield
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FIntPoint CachedExtentMin;
+
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	FIntPoint CachedExtentMax;
+
+	// Hash of the heightfield's transform and of the attributes set on its volumes (materials, tags, paths) as last uploaded.
+	// The heightfield is rebuilt if they have changed.
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	uint32 CachedAttributesHash;
 };
 
 
@@ -687,6 +733,9 @@ struct FHoudiniBrushInfo
 
 	bool HasChanged() const;
 
+	// Returns a hash of the cached brush, transform, type and surface properties
+	uint64 GetHash() const;
+
 	static int32 GetNumVertexIndicesFromModel(const UModel* Model);
 
 	FHoudiniBrushInfo();
@@ -760,8 +809,14 @@ public:
 	// Check whether any of the brushes, or their transforms, used to generate this model have changed.
 	bool HasBrushesChanged(const TArray<ABrush*>& InBrushes) const;
 
+	// Hash of the brushes that were used to generate the cached model.
+	uint64 GetCachedModelHash() const { return CombinedModelHash; };
+
 	// Cache the combined model as well as the input brushes.
-	void UpdateCachedData(UModel* InCombinedModel, const TArray<ABrush*>& InBrushes);
+	void UpdateCachedData(UModel* InCombinedModel, const TArray<ABrush*>& InBrushes, const uint64& InCombinedModelHash);
+
+	// Returns the combined hash of the brushes' surfaces and transforms, used to key the cached model.
+	static uint64 GetBrushesHash(const TArray<ABrush*>& InBrushes);
 
 	// Returns whether this input object should be ignored when uploading objects to Houdini.
 	// This mechanism could be implemented on UHoudiniInputObject.
@@ -779,6 +834,9 @@ protected:
 	UPROPERTY(Transient, DuplicateTransient)
 	UModel* CombinedModel;
 
+	UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+	uint64 CombinedModelHash;
+
 	UPROPERTY()
 	bool bIgnoreInputObject;
 
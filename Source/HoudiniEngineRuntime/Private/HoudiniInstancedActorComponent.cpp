@@ -115,6 +115,7 @@ UHoudiniInstancedActorComponent::Serialize(FArchive& Ar)
 void UHoudiniInstancedActorComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
 {
     ClearAllInstances();
+    EmptyActorPools();
     Super::OnComponentDestroyed( bDestroyingHierarchy );
 }
 
@@ -129,6 +130,9 @@ UHoudiniInstancedActorComponent::AddReferencedObjects(UObject * InThis, FReferen
             Collector.AddReferencedObject( ThisHIAC->InstancedObject, ThisHIAC );
 
         Collector.AddReferencedObjects(ThisHIAC->InstancedActors, ThisHIAC );
+
+        for (auto& CurrentPool : ThisHIAC->ActorPools)
+            Collector.AddReferencedObjects(CurrentPool.Value.Actors, ThisHIAC);
     }
 }
 
@@ -185,6 +189,7 @@ UHoudiniInstancedActorComponent::ClearAllInstances()
             Instance->Destroy();
     }
     InstancedActors.Empty();
+    ClearPendingSpawns();
 }
 
 
@@ -193,15 +198,11 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 {
 	int32 OldInstanceNum = InstancedActors.Num();
 
-	// If we want less instances than we already have, destroy the extra properly
+	// If we want less instances than we already have, keep the extra in the pool
 	if (NewInstanceNum < OldInstanceNum)
 	{
-		for (int32 Idx = NewInstanceNum - 1; Idx < InstancedActors.Num(); Idx++)
-		{
-			AActor* Instance = InstancedActors.IsValidIndex(Idx) ? InstancedActors[Idx] : nullptr;
-			if (Instance && !Instance->IsPendingKill())
-				Instance->Destroy();
-		}
+		for (int32 Idx = NewInstanceNum; Idx < OldInstanceNum; Idx++)
+			ReleaseActorToPool(InstancedActors[Idx]);
 	}
 	
 	// Grow the array with nulls if needed
@@ -209,6 +210,116 @@ UHoudiniInstancedActorComponent::SetNumberOfInstances(const int32& NewInstanceNu
 }
 
 
+void
+UHoudiniInstancedActorComponent::ReleaseActorToPool(AActor* InActor)
+{
+	if (!InActor || InActor->IsPendingKill())
+		return;
+
+	if (!InstancedObject || InstancedObject->IsPendingKill())
+	{
+		InActor->Destroy();
+		return;
+	}
+
+	// Hide the actor, and flag it transient so it doesn't get saved with the level
+	InActor->SetActorHiddenInGame(true);
+	InActor->SetActorEnableCollision(false);
+#if WITH_EDITOR
+	InActor->SetIsTemporarilyHiddenInEditor(true);
+#endif
+	InActor->SetFlags(RF_Transient);
+
+	ActorPools.FindOrAdd(InstancedObject).Actors.Add(InActor);
+}
+
+
+void
+UHoudiniInstancedActorComponent::ReleaseAllInstancesToPool()
+{
+	for (AActor* Instance : InstancedActors)
+		ReleaseActorToPool(Instance);
+
+	InstancedActors.Empty();
+	ClearPendingSpawns();
+}
+
+
+AActor*
+UHoudiniInstancedActorComponent::AcquirePooledActor()
+{
+	FHoudiniInstancedActorPool* Pool = ActorPools.Find(InstancedObject);
+	if (!Pool)
+		return nullptr;
+
+	while (Pool->Actors.Num() > 0)
+	{
+		AActor* PooledActor = Pool->Actors.Pop(false);
+		if (!PooledActor || PooledActor->IsPendingKill())
+			continue;
+
+		PooledActor->ClearFlags(RF_Transient);
+		PooledActor->SetActorHiddenInGame(false);
+		PooledActor->SetActorEnableCollision(true);
+#if WITH_EDITOR
+		PooledActor->SetIsTemporarilyHiddenInEditor(false);
+#endif
+		return PooledActor;
+	}
+
+	return nullptr;
+}
+
+
+void
+UHoudiniInstancedActorComponent::EmptyActorPools()
+{
+	for (auto& CurrentPool : ActorPools)
+	{
+		for (AActor* PooledActor : CurrentPool.Value.Actors)
+		{
+			if (PooledActor && !PooledActor->IsPendingKill())
+				PooledActor->Destroy();
+		}
+	}
+	ActorPools.Empty();
+}
+
+
+void
+UHoudiniInstancedActorComponent::TrimActorPools()
+{
+	for (auto It = ActorPools.CreateIterator(); It; ++It)
+	{
+		UObject* PoolObject = It.Key();
+		if (PoolObject && !PoolObject->IsPendingKill() && PoolObject == InstancedObject)
+		{
+			// Only keep the valid actors of the current object's pool
+			It.Value().Actors.RemoveAll([](AActor* InActor) { return !InActor || InActor->IsPendingKill(); });
+			if (It.Value().Actors.Num() > 0)
+				continue;
+		}
+
+		for (AActor* PooledActor : It.Value().Actors)
+		{
+			if (PooledActor && !PooledActor->IsPendingKill())
+				PooledActor->Destroy();
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+
+void
+UHoudiniInstancedActorComponent::ClearPendingSpawns()
+{
+	PendingSpawnIndices.Empty();
+	PendingSpawnTransforms.Empty();
+	PendingSpawnPropertyAttributes.Empty();
+}
+
+
 void 
 UHoudiniInstancedActorComponent::OnComponentCreated()
 {
@@ -27,9 +27,19 @@
 #pragma once
 
 #include "Components/SceneComponent.h"
+#include "HoudiniGenericAttribute.h"
 
 #include "HoudiniInstancedActorComponent.generated.h"
 
+// Actors that were spawned for a given instanced object but are currently unused
+USTRUCT()
+struct HOUDINIENGINERUNTIME_API FHoudiniInstancedActorPool
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> Actors;
+};
 
 UCLASS()//( config = Engine )
 class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneComponent
@@ -79,6 +89,33 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
+
+		// Hide all the current instances and keep them in the pool of their instanced object
+		void ReleaseAllInstancesToPool();
+
+		// Returns a pooled actor for the current instanced object, or null if the pool is empty
+		AActor* AcquirePooledActor();
+
+		// Destroy all the actors left in the pools
+		void EmptyActorPools();
+
+		// Destroy the pools of the objects that aren't instanced anymore
+		void TrimActorPools();
+
+		// Pending spawns accessors
+		bool HasPendingSpawns() const { return PendingSpawnIndices.Num() > 0; }
+		TArray<int32>& GetPendingSpawnIndicesForWrite() { return PendingSpawnIndices; }
+		TArray<FTransform>& GetPendingSpawnTransformsForWrite() { return PendingSpawnTransforms; }
+		TArray<FHoudiniGenericAttribute>& GetPendingSpawnPropertyAttributesForWrite() { return PendingSpawnPropertyAttributes; }
+		void ClearPendingSpawns();
+
+		// Handle of the ticker spawning the pending instances
+		FDelegateHandle PendingSpawnTickerHandle;
+
+	protected:
+
+		// Hide an instance and keep it in the pool of the current instanced object
+		void ReleaseActorToPool(AActor* InActor);
   
 	private:
 
@@ -88,4 +125,18 @@ class HOUDINIENGINERUNTIME_API UHoudiniInstancedActorComponent : public USceneCo
 		UPROPERTY(VisibleInstanceOnly, Category = Instances )
 		TArray<AActor*> InstancedActors;
 
+		// Unused actors, per instanced object, that can be reused instead of spawning new ones
+		UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+		TMap<UObject*, FHoudiniInstancedActorPool> ActorPools;
+
+		// Instances that still need to be spawned, their transforms and property attributes
+		UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+		TArray<int32> PendingSpawnIndices;
+
+		UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+		TArray<FTransform> PendingSpawnTransforms;
+
+		UPROPERTY(Transient, DuplicateTransient, NonTransactional)
+		TArray<FHoudiniGenericAttribute> PendingSpawnPropertyAttributes;
+
 };
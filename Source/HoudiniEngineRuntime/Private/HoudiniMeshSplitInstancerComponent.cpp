@@ -133,6 +133,15 @@ UHoudiniMeshSplitInstancerComponent::AddReferencedObjects( UObject * InThis, FRe
 bool 
 UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms( 
     const TArray<FTransform>& InstanceTransforms)
+{
+	return SetInstances(InstanceTransforms, TArray<FLinearColor>());
+}
+
+bool
+UHoudiniMeshSplitInstancerComponent::SetInstances(
+	const TArray<FTransform>& InstanceTransforms,
+	const TArray<FLinearColor>& InstanceColors,
+	TArray<int32>* OutColorChangedInstances)
 {
 	if (Instances.Num() <= 0 && InstanceTransforms.Num() <= 0)
 		return false;
@@ -150,15 +159,18 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         return false;
     }
 
-    // Only create new SMC for newly added instances
+	// Only create new SMC for newly added instances,
+	// their registration is deferred until all of them have been set up
+	TArray<UStaticMeshComponent*> NewInstances;
+	NewInstances.Reserve(FMath::Max(0, InstanceTransforms.Num() - Instances.Num()));
+	Instances.Reserve(InstanceTransforms.Num());
     for (int32 iAdd = Instances.Num(); iAdd < InstanceTransforms.Num(); iAdd++)
     {
-        const FTransform& InstanceTransform = InstanceTransforms[iAdd];
         UStaticMeshComponent* SMC = NewObject< UStaticMeshComponent >(
             GetOwner(), UStaticMeshComponent::StaticClass(), NAME_None, RF_Transactional);
 
-        SMC->SetRelativeTransform(InstanceTransform);
         Instances.Add(SMC);
+		NewInstances.Add(SMC);
 		GetOwner()->AddInstanceComponent(SMC);
     }
 
@@ -167,6 +179,8 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 	if (InstanceTransforms.Num() != Instances.Num())
 		return false;
 
+	const int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
+	const bool bVisible = IsVisible();
     for (int32 iIns = 0; iIns < Instances.Num(); ++iIns)
     {
         UStaticMeshComponent* SMC = Instances[iIns];
@@ -175,13 +189,16 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
         if (!SMC || SMC->IsPendingKill())
             continue;
 
-        SMC->SetRelativeTransform(InstanceTransform);
+		// Only touch the properties that have changed on reused components
+		if (!SMC->GetRelativeTransform().Equals(InstanceTransform))
+			SMC->SetRelativeTransform(InstanceTransform);
 
         // Attach created static mesh component to this thing
-        SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
+		if (SMC->GetAttachParent() != this)
+			SMC->AttachToComponent(this, FAttachmentTransformRules::KeepRelativeTransform);
 
-        SMC->SetStaticMesh(InstancedMesh);
-        SMC->SetVisibility(IsVisible());
+		const bool bMeshChanged = SMC->SetStaticMesh(InstancedMesh);
+		SMC->SetVisibility(bVisible);
         SMC->SetMobility(Mobility);
 
 		// TODO: Revert to default if override is null??
@@ -196,12 +213,30 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 
 		if (MI && !MI->IsPendingKill())
         {
-            int32 MeshMaterialCount = InstancedMesh->StaticMaterials.Num();
             for (int32 Idx = 0; Idx < MeshMaterialCount; ++Idx)
-                SMC->SetMaterial(Idx, MI);
+			{
+				if (SMC->GetMaterial(Idx) != MI)
+					SMC->SetMaterial(Idx, MI);
+			}
         }
 
-        SMC->RegisterComponent();
+		if (InstanceColors.IsValidIndex(iIns))
+		{
+			const FLinearColor& Color = InstanceColors[iIns];
+			const TArray<float>& CurrentData = SMC->GetCustomPrimitiveData().Data;
+			bool bColorChanged = false;
+			if (CurrentData.Num() < 4 
+				|| CurrentData[0] != Color.R || CurrentData[1] != Color.G 
+				|| CurrentData[2] != Color.B || CurrentData[3] != Color.A)
+			{
+				SMC->SetCustomPrimitiveDataVector4(0, FVector4(Color.R, Color.G, Color.B, Color.A));
+				bColorChanged = true;
+			}
+
+			// The vertex colors need to be updated as well if the mesh has changed
+			if (OutColorChangedInstances && (bColorChanged || bMeshChanged))
+				OutColorChangedInstances->Add(iIns);
+		}
 
 		/*
 		// TODO:
@@ -213,6 +248,13 @@ UHoudiniMeshSplitInstancerComponent::SetInstanceTransforms(
 		*/
     }
 
+	// Register all the new components at once
+	for (UStaticMeshComponent* SMC : NewInstances)
+	{
+		if (SMC && !SMC->IsPendingKill())
+			SMC->RegisterComponent();
+	}
+
 	return true;
 }
 
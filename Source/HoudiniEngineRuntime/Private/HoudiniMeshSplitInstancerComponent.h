@@ -66,6 +66,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniMeshSplitInstancerComponent : public USce
 
 		// Set the instances. Transforms are given in local space of this component.
 		bool SetInstanceTransforms(const TArray<FTransform>& InstanceTransforms);
+
+		// Set the instances and their colors. Transforms are given in local space of this component.
+		// Existing components are reused, new ones are registered together once they are all set up.
+		// Colors are stored in the components' custom primitive data (indices 0-3).
+		// OutColorChangedInstances receives the indices of the instances whose color or mesh has changed.
+		bool SetInstances(
+			const TArray<FTransform>& InstanceTransforms,
+			const TArray<FLinearColor>& InstanceColors,
+			TArray<int32>* OutColorChangedInstances = nullptr);
     		
 		// Instance Accessor
 		TArray<class UStaticMeshComponent*>& GetInstancesForWrite() { return Instances; }		
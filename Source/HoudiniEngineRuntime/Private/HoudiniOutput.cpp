@@ -353,11 +353,52 @@ FHoudiniBakedOutputObject::GetBlueprintIfValid(bool bInTryLoad) const
 	return Cast<UBlueprint>(Object);
 }
 
+void
+FHoudiniOutputChangeSet::Reset()
+{
+	Added.Empty();
+	GeoChanged.Empty();
+	TransformOnly.Empty();
+	AttributeOnly.Empty();
+	Removed.Empty();
+}
+
+bool
+FHoudiniOutputChangeSet::HasChanges() const
+{
+	return Added.Num() > 0
+		|| GeoChanged.Num() > 0
+		|| TransformOnly.Num() > 0
+		|| AttributeOnly.Num() > 0
+		|| Removed.Num() > 0;
+}
+
+bool
+FHoudiniOutputChangeSet::IsTransformOnly() const
+{
+	return TransformOnly.Num() > 0
+		&& Added.Num() <= 0
+		&& GeoChanged.Num() <= 0
+		&& AttributeOnly.Num() <= 0
+		&& Removed.Num() <= 0;
+}
+
+bool
+FHoudiniOutputChangeSet::HasHGPOChanged(const int32& InHGPOIndex) const
+{
+	return Added.Contains(InHGPOIndex)
+		|| GeoChanged.Contains(InHGPOIndex)
+		|| TransformOnly.Contains(InHGPOIndex)
+		|| AttributeOnly.Contains(InHGPOIndex);
+}
+
 
 UHoudiniOutput::UHoudiniOutput(const FObjectInitializer & ObjectInitializer)
 	: Super(ObjectInitializer)
 	, Type(EHoudiniOutputType::Invalid)
 	, StaleCount(0)
+	, HGPOIdentityMapNum(-1)
+	, bHasLoadedHGPO(false)
 	, bLandscapeWorldComposition(false)
 	, bIsEditableNode(false)
 	, bHasEditableNodeBuilt(false)
@@ -373,6 +414,8 @@ UHoudiniOutput::~UHoudiniOutput()
 	bIsUpdating = false;
 
 	HoudiniGeoPartObjects.Empty();
+	HGPOIdentityMap.Empty();
+	ChangeSet.Reset();
 	OutputObjects.Empty();
 	InstancedOutputs.Empty();
 	AssignementMaterials.Empty();
@@ -492,6 +535,8 @@ UHoudiniOutput::Clear()
 	StaleCount = 0;
 
 	HoudiniGeoPartObjects.Empty();
+	InvalidateHGPOIdentityMap();
+	ChangeSet.Reset();
 
 	for (auto& CurrentOutputObject : OutputObjects)
 	{
@@ -575,48 +620,120 @@ UHoudiniOutput::HasMaterialsChanged() const
 const bool 
 UHoudiniOutput::HasHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) const
 {
-	return HoudiniGeoPartObjects.Find(InHGPO) != INDEX_NONE;
+	return FindHoudiniGeoPartObjectIndex(InHGPO) != INDEX_NONE;
 }
 
-const bool
-UHoudiniOutput::HeightfieldMatch(const FHoudiniGeoPartObject& InHGPO, const bool& bVolumeNameShouldMatch) const
-{	
-	if (InHGPO.Type != EHoudiniPartType::Volume)
-		return false;
+void
+UHoudiniOutput::UpdateHGPOIdentityMap() const
+{
+	const int32 NumHGPOs = HoudiniGeoPartObjects.Num();
+	if (HGPOIdentityMapNum < 0 || HGPOIdentityMapNum > NumHGPOs)
+	{
+		HGPOIdentityMap.Reset();
+		HGPOIdentityMapNum = 0;
+		bHasLoadedHGPO = false;
+	}
 
-	if (InHGPO.VolumeName.IsEmpty())
-		return false;
+	// HGPOs are only appended, so we just need to index the new ones
+	for (int32 Idx = HGPOIdentityMapNum; Idx < NumHGPOs; Idx++)
+	{
+		const FHoudiniGeoPartObject& CurrentHGPO = HoudiniGeoPartObjects[Idx];
+		HGPOIdentityMap.Add(CurrentHGPO.GetIdIdentityHash(), Idx);
+		HGPOIdentityMap.Add(CurrentHGPO.GetNameIdentityHash(), Idx);
+		if (CurrentHGPO.Type == EHoudiniPartType::Volume)
+			HGPOIdentityMap.Add(CurrentHGPO.GetHeightfieldIdentityHash(), Idx);
 
-	for (auto& currentHGPO : HoudiniGeoPartObjects)
+		bHasLoadedHGPO |= CurrentHGPO.bLoaded;
+	}
+
+	HGPOIdentityMapNum = NumHGPOs;
+}
+
+int32
+UHoudiniOutput::FindHoudiniGeoPartObjectIndex(const FHoudiniGeoPartObject& InHGPO, const int32& InStartIndex, const int32& InEndIndex) const
+{
+	const int32 EndIndex = InEndIndex < 0 ? HoudiniGeoPartObjects.Num() : FMath::Min(InEndIndex, HoudiniGeoPartObjects.Num());
+
+	UpdateHGPOIdentityMap();
+
+	// Loaded HGPOs can be matched by their part names only, so we need to check them all
+	if (bHasLoadedHGPO || InHGPO.bLoaded)
 	{
-		// Asset/Object/Geo IDs should match
-		if (currentHGPO.AssetId != InHGPO.AssetId
-			|| currentHGPO.ObjectId != InHGPO.ObjectId
-			|| currentHGPO.GeoId != InHGPO.GeoId)
+		for (int32 Idx = InStartIndex; Idx < EndIndex; Idx++)
 		{
-			continue;
+			if (HoudiniGeoPartObjects[Idx] == InHGPO)
+				return Idx;
 		}
 
-		// Both HGPO type should be volumes
-		if (currentHGPO.Type != EHoudiniPartType::Volume)
-		{
-			continue;
-		}
+		return INDEX_NONE;
+	}
 
-		// Volume tile index should match
-		if (currentHGPO.VolumeTileIndex != InHGPO.VolumeTileIndex)
+	int32 FoundIndex = INDEX_NONE;
+	auto CheckCandidates = [&](const uint32& InHash)
+	{
+		for (auto It = HGPOIdentityMap.CreateConstKeyIterator(InHash); It; ++It)
 		{
-			continue;
+			const int32 Idx = It.Value();
+			if (Idx < InStartIndex || Idx >= EndIndex)
+				continue;
+
+			// Keep the first match, like a linear search would
+			if (FoundIndex != INDEX_NONE && Idx >= FoundIndex)
+				continue;
+
+			if (HoudiniGeoPartObjects[Idx] == InHGPO)
+				FoundIndex = Idx;
 		}
+	};
 
-		// We've specified if we want the name to match/to be different:
-		// when looking in previous outputs, we want the name to match
-		// when looking in newly created outputs, we want to be sure the names are different
-		bool bNameMatch = InHGPO.VolumeName.Equals(currentHGPO.VolumeName, ESearchCase::IgnoreCase);
-		if (bNameMatch != bVolumeNameShouldMatch)
-			continue;
+	CheckCandidates(InHGPO.GetIdIdentityHash());
+	CheckCandidates(InHGPO.GetNameIdentityHash());
 
-		return true;
+	return FoundIndex;
+}
+
+// Returns true if both HGPOs are volumes from the same heightfield tile
+static bool
+IsSameHeightfield(const FHoudiniGeoPartObject& InHGPO, const FHoudiniGeoPartObject& InOtherHGPO, const bool& bVolumeNameShouldMatch)
+{
+	// Asset/Object/Geo IDs should match
+	if (InOtherHGPO.AssetId != InHGPO.AssetId
+		|| InOtherHGPO.ObjectId != InHGPO.ObjectId
+		|| InOtherHGPO.GeoId != InHGPO.GeoId)
+	{
+		return false;
+	}
+
+	// Both HGPO type should be volumes
+	if (InOtherHGPO.Type != EHoudiniPartType::Volume)
+		return false;
+
+	// Volume tile index should match
+	if (InOtherHGPO.VolumeTileIndex != InHGPO.VolumeTileIndex)
+		return false;
+
+	// We've specified if we want the name to match/to be different:
+	// when looking in previous outputs, we want the name to match
+	// when looking in newly created outputs, we want to be sure the names are different
+	bool bNameMatch = InHGPO.VolumeName.Equals(InOtherHGPO.VolumeName, ESearchCase::IgnoreCase);
+	return bNameMatch == bVolumeNameShouldMatch;
+}
+
+const bool
+UHoudiniOutput::HeightfieldMatch(const FHoudiniGeoPartObject& InHGPO, const bool& bVolumeNameShouldMatch) const
+{	
+	if (InHGPO.Type != EHoudiniPartType::Volume)
+		return false;
+
+	if (InHGPO.VolumeName.IsEmpty())
+		return false;
+
+	// Only the volumes of the same heightfield tile share the heightfield hash
+	UpdateHGPOIdentityMap();
+	for (auto It = HGPOIdentityMap.CreateConstKeyIterator(InHGPO.GetHeightfieldIdentityHash()); It; ++It)
+	{
+		if (IsSameHeightfield(InHGPO, HoudiniGeoPartObjects[It.Value()], bVolumeNameShouldMatch))
+			return true;
 	}
 
 	return false;
@@ -633,15 +750,87 @@ UHoudiniOutput::MarkAllHGPOsAsStale(const bool& bInStale)
 void 
 UHoudiniOutput::DeleteAllStaleHGPOs()
 {
+	// Build the change set by matching the new HGPOs with the stale ones
+	ChangeSet.Reset();
+
+	TBitArray<> StaleMatched(false, StaleCount);
+	for (int32 NewIdx = StaleCount; NewIdx < HoudiniGeoPartObjects.Num(); NewIdx++)
+	{
+		// Indices in the change set are the ones after the deletion
+		const int32 FinalIdx = NewIdx - StaleCount;
+		const int32 StaleIdx = FindHoudiniGeoPartObjectIndex(HoudiniGeoPartObjects[NewIdx], 0, StaleCount);
+		if (StaleIdx == INDEX_NONE)
+		{
+			ChangeSet.Added.Add(FinalIdx);
+			continue;
+		}
+
+		StaleMatched[StaleIdx] = true;
+		AddHGPOToChangeSet(HoudiniGeoPartObjects[StaleIdx], NewIdx);
+	}
+
+	for (int32 StaleIdx = 0; StaleIdx < StaleCount; StaleIdx++)
+	{
+		if (!StaleMatched[StaleIdx])
+			ChangeSet.Removed.Add(HoudiniGeoPartObjects[StaleIdx]);
+	}
+
 	// Simply delete the first "StaleCount" objects and reset the stale marker
 	HoudiniGeoPartObjects.RemoveAt(0, StaleCount);
+	if (StaleCount > 0)
+		InvalidateHGPOIdentityMap();
+
 	StaleCount = 0;
 }
 
+void
+UHoudiniOutput::AddHGPOToChangeSet(const FHoudiniGeoPartObject& InOldHGPO, const int32& InNewIndex)
+{
+	const FHoudiniGeoPartObject& NewHGPO = HoudiniGeoPartObjects[InNewIndex];
+	const int32 FinalIdx = InNewIndex - StaleCount;
+
+	if (InOldHGPO.bLoaded
+		|| NewHGPO.bHasGeoChanged
+		|| NewHGPO.bHasPartChanged
+		|| InOldHGPO.Type != NewHGPO.Type
+		|| InOldHGPO.InstancerType != NewHGPO.InstancerType
+		|| InOldHGPO.PartInfo.PointCount != NewHGPO.PartInfo.PointCount
+		|| InOldHGPO.PartInfo.VertexCount != NewHGPO.PartInfo.VertexCount
+		|| InOldHGPO.PartInfo.FaceCount != NewHGPO.PartInfo.FaceCount)
+	{
+		ChangeSet.GeoChanged.Add(FinalIdx);
+	}
+	else if (NewHGPO.bHasTransformChanged || !InOldHGPO.TransformMatrix.Equals(NewHGPO.TransformMatrix))
+	{
+		ChangeSet.TransformOnly.Add(FinalIdx);
+	}
+	else if (NewHGPO.bHasMaterialsChanged || !FHoudiniAttributeManifest::HaveSameAttributes(InOldHGPO.AttributeManifest, NewHGPO.AttributeManifest))
+	{
+		ChangeSet.AttributeOnly.Add(FinalIdx);
+	}
+}
+
 void 
 UHoudiniOutput::AddNewHGPO(const FHoudiniGeoPartObject& InHGPO)
 {
 	HoudiniGeoPartObjects.Add(InHGPO);
+
+	// HGPOs added after the stale ones have been deleted (ie. unassigned volumes)
+	// complete the current change set, and may match one of the removed HGPOs
+	if (StaleCount == 0)
+	{
+		const int32 NewIdx = HoudiniGeoPartObjects.Num() - 1;
+		const int32 RemovedIdx = ChangeSet.Removed.IndexOfByKey(InHGPO);
+		if (RemovedIdx == INDEX_NONE)
+		{
+			ChangeSet.Added.Add(NewIdx);
+		}
+		else
+		{
+			AddHGPOToChangeSet(ChangeSet.Removed[RemovedIdx], NewIdx);
+			ChangeSet.Removed.RemoveAtSwap(RemovedIdx);
+		}
+	}
 }
 
 void
@@ -728,6 +917,9 @@ UHoudiniOutput::CopyPropertiesFrom(UHoudiniOutput* InInput, bool bCopyAllPropert
 		// Restore the desired properties.
 		OutputObjects = PrevOutputObjects;
 		InstancedOutputs = PrevInstancedOutputs;
+
+		// Our HGPOs have been replaced
+		InvalidateHGPOIdentityMap();
 	}
 
 	// Copy any additional DuplicateTransient properties.
@@ -779,6 +971,7 @@ UHoudiniOutput::MarkAsLoaded(const bool& InLoaded)
 	{
 		HGPO.bLoaded = InLoaded;
 	}
+	InvalidateHGPOIdentityMap();
 
 	// Mark all output object's identifier as loaded
 	for (auto& Iter : OutputObjects)
@@ -796,6 +989,29 @@ UHoudiniOutput::MarkAsLoaded(const bool& InLoaded)
 }
 
 
+void
+UHoudiniOutput::UpdateObjectTransforms(const TMap<int32, FTransform>& InObjectTransforms)
+{
+	ChangeSet.Reset();
+
+	for (int32 Idx = 0; Idx < HoudiniGeoPartObjects.Num(); Idx++)
+	{
+		FHoudiniGeoPartObject& CurrentHGPO = HoudiniGeoPartObjects[Idx];
+		const FTransform* NewTransform = InObjectTransforms.Find(CurrentHGPO.ObjectId);
+		if (!NewTransform)
+			continue;
+
+		CurrentHGPO.TransformMatrix = *NewTransform;
+		CurrentHGPO.ObjectInfo.bHasTransformChanged = true;
+		CurrentHGPO.bHasTransformChanged = true;
+		CurrentHGPO.bHasGeoChanged = false;
+		CurrentHGPO.bHasPartChanged = false;
+		CurrentHGPO.bHasMaterialsChanged = false;
+
+		ChangeSet.TransformOnly.Add(Idx);
+	}
+}
+
 const bool 
 UHoudiniOutput::HasAnyProxy() const
 {
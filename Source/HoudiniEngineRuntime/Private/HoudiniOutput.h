@@ -212,6 +212,13 @@ public:
 	UPROPERTY()
 	TArray<FTransform> OriginalTransforms;
 
+	// Original per-instance custom data, NumCustomDataFloats values for each original transform
+	UPROPERTY()
+	TArray<float> OriginalCustomData;
+
+	UPROPERTY()
+	int32 NumCustomDataFloats = 0;
+
 	// Variation objects currently used for instancing
 	UPROPERTY()
 	TArray<TSoftObjectPtr<UObject>> VariationObjects;
@@ -367,6 +374,32 @@ struct HOUDINIENGINERUNTIME_API FHoudiniOutputObject
 		TMap<FString, FString> CachedTokens;
 };
 
+// Summary of the changes made to an output's HGPOs by the last cook
+struct HOUDINIENGINERUNTIME_API FHoudiniOutputChangeSet
+{
+	void Reset();
+
+	// Returns true if any HGPO was added, removed or modified
+	bool HasChanges() const;
+
+	// Returns true if the only changes are transform changes
+	bool IsTransformOnly() const;
+
+	// Returns true if the HGPO at the given index was added or modified
+	bool HasHGPOChanged(const int32& InHGPOIndex) const;
+
+	// Indices (in the output's HGPO array) of the HGPOs that are new to this output
+	TArray<int32> Added;
+	// Indices of the HGPOs whose geometry has changed
+	TArray<int32> GeoChanged;
+	// Indices of the HGPOs whose transform changed, but not their geometry
+	TArray<int32> TransformOnly;
+	// Indices of the HGPOs whose materials or attributes changed, but not their geometry or transform
+	TArray<int32> AttributeOnly;
+	// The HGPOs that have been removed from this output
+	TArray<FHoudiniGeoPartObject> Removed;
+};
+
 UCLASS()
 class HOUDINIENGINERUNTIME_API UHoudiniOutput : public UObject
 {
@@ -391,6 +424,12 @@ public:
 	// Returns true if we have a HGPO that matches
 	const bool HasHoudiniGeoPartObject(const FHoudiniGeoPartObject& InHGPO) const;
 
+	// Returns the index of the first HGPO that matches in the [InStartIndex, InEndIndex[ range (all if InEndIndex < 0)
+	int32 FindHoudiniGeoPartObjectIndex(const FHoudiniGeoPartObject& InHGPO, const int32& InStartIndex = 0, const int32& InEndIndex = -1) const;
+
+	// Returns the changes made to our HGPOs by the last cook
+	const FHoudiniOutputChangeSet& GetChangeSet() const { return ChangeSet; };
+
 	// Returns true if the HGPO is fromn the same HF as us
 	const bool HeightfieldMatch(const FHoudiniGeoPartObject& InHGPO, const bool& bVolumeNameShouldMatch) const;
 
@@ -437,6 +476,7 @@ public:
 	void MarkAllHGPOsAsStale(const bool& InStale);
 
 	// Delete all the HGPO that were marked as stale
+	// and update the change set by matching them to the new HGPOs
 	void DeleteAllStaleHGPOs();
 
 	void SetOutputObjects(const TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& InOutputObjects) { OutputObjects = InOutputObjects; };
@@ -446,6 +486,10 @@ public:
 	// Marks all HGPO and OutputIdentifier as loaded
 	void MarkAsLoaded(const bool& InLoaded);
 
+	// Updates the transform of the HGPOs of the given objects (ObjectId -> Transform)
+	// The change set is replaced by these transform-only changes.
+	void UpdateObjectTransforms(const TMap<int32, FTransform>& InObjectTransforms);
+
 	FORCEINLINE
 	const bool IsEditableNode() { return bIsEditableNode; };
 
@@ -500,6 +544,15 @@ protected:
 
 	virtual void BeginDestroy() override;
 
+	// Makes sure the HGPO identity map indexes all our HGPOs
+	void UpdateHGPOIdentityMap() const;
+
+	// Invalidates the HGPO identity map, needed when HGPOs are removed or modified
+	void InvalidateHGPOIdentityMap() const { HGPOIdentityMapNum = -1; };
+
+	// Adds a new HGPO to the change set, by comparing it to its stale/removed counterpart
+	void AddHGPOToChangeSet(const FHoudiniGeoPartObject& InOldHGPO, const int32& InNewIndex);
+
 protected:
 
 	// Indicates the type of output we're dealing with
@@ -529,6 +582,16 @@ protected:
 	// Indicates the number of stale HGPO
 	int32 StaleCount;
 
+	// Transient index of our HGPOs identity hashes to their indices in the HGPO array
+	mutable TMultiMap<uint32, int32> HGPOIdentityMap;
+	// Number of HGPOs indexed in the identity map, -1 if it needs to be rebuilt
+	mutable int32 HGPOIdentityMapNum;
+	// Loaded HGPOs can't be matched by their identity hashes
+	mutable bool bHasLoadedHGPO;
+
+	// The changes made to our HGPOs by the last cook
+	FHoudiniOutputChangeSet ChangeSet;
+
 	UPROPERTY()
 	bool bLandscapeWorldComposition;
 
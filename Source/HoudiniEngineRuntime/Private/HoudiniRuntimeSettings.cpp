@@ -103,6 +103,7 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
 	// Static mesh proxy refinement settings
 	bEnableProxyStaticMesh = false;
 	bShowDefaultMesh = true;
+	bUsePlaceholderMaterialWhileCompiling = false;
 	bEnableProxyStaticMeshRefinementByTimer = true;
 	ProxyMeshAutoRefineTimeoutSeconds = 10.0f;
 	bEnableProxyStaticMeshRefinementOnPreSaveWorld = true;
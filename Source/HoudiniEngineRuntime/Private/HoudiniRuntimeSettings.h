@@ -287,6 +287,12 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Static Mesh", meta = (DisplayName = "Show Default Mesh"))
 		bool bShowDefaultMesh;
 
+		// Should outputs display the Houdini placeholder material instead of the engine's default material while their
+		// generated materials' shaders are compiling? The generated materials are swapped back in once compiled,
+		// and before the outputs are baked or saved.
+		UPROPERTY(GlobalConfig, EditAnywhere, Category = "Static Mesh", meta = (DisplayName = "Use Placeholder Material While Compiling Generated Materials"))
+		bool bUsePlaceholderMaterialWhileCompiling;
+
 		// If fast proxy meshes are being created, must it be baked as a StaticMesh after a period of no updates?
 		UPROPERTY(GlobalConfig, EditAnywhere, AdvancedDisplay, Category = "Static Mesh", meta = (DisplayName = "Refine Proxy Static Meshes After a Timeout", EditCondition = "bEnableProxyStaticMesh"))
 		bool bEnableProxyStaticMeshRefinementByTimer;